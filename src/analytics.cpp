@@ -0,0 +1,75 @@
+#include "graph_analytics.h"
+#include "lexicon_graph.h"
+#include "parallel_for.h"
+#include "parallel_loader.h"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Prints the shape of the graph of every word length of a lexicon and exports the hardest pairs, to
+// pick worst-case benchmark queries from.
+// usage: analytics [lexicon = ./english.txt] [output = ./hard_pairs.tsv] [pairs per list = 10] [threads]
+
+/**
+ * @brief helper function to print a degree histogram compactly, as degree:words for every degree
+ * some word has
+ *
+ * @param histogram - the number of words with each degree
+ */
+auto print_histogram(const std::vector<std::size_t>& histogram) -> void {
+	for (auto degree = std::size_t{0}; degree < histogram.size(); ++degree) {
+		if (histogram[degree] != 0) {
+			std::cout << " " << degree << ":" << histogram[degree];
+		}
+	}
+	std::cout << std::endl;
+}
+
+auto main(int argc, char* argv[]) -> int {
+	auto const arguments = std::vector<std::string>(argv + 1, argv + argc);
+	auto const lexicon_path = arguments.size() > 0 ? arguments[0] : std::string("./english.txt");
+	auto const output_path = arguments.size() > 1 ? arguments[1] : std::string("./hard_pairs.tsv");
+	auto const top_count = arguments.size() > 2 ? std::stoul(arguments[2]) : std::size_t{10};
+	auto const thread_count = arguments.size() > 3 ? std::stoul(arguments[3]) : ::word_ladder::default_thread_count();
+
+	auto const image = ::word_ladder::load_graph_image(lexicon_path, thread_count);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	std::cout << graph.word_count() << " words, longest " << graph.max_length() << " letters, " << thread_count
+	          << " threads" << std::endl;
+
+	auto reports = std::vector<::word_ladder::length_report>{};
+	for (auto length = std::size_t{1}; length <= graph.max_length(); ++length) {
+		auto const start = std::chrono::steady_clock::now();
+		auto report = ::word_ladder::analyse_length(graph, length, top_count, thread_count);
+		auto const ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		if (report.word_count == 0) {
+			continue;
+		}
+		std::cout << "length " << length << ": " << report.word_count << " words, " << report.edge_count
+		          << " edges, " << report.component_sizes.size() << " components (largest "
+		          << report.component_sizes.front() << "), diameter " << report.diameter << " in "
+		          << report.searches << " searches, " << ms << " ms" << std::endl;
+		std::cout << "  degrees:";
+		print_histogram(report.degree_histogram);
+		if (not report.longest.empty()) {
+			auto const& longest = report.longest.front();
+			auto const& most = report.most_ladders.front();
+			std::cout << "  longest " << longest.from << " -> " << longest.to << " (" << longest.rungs
+			          << " rungs), most ladders " << most.from << " -> " << most.to << " (" << most.ladders << ")"
+			          << std::endl;
+		}
+		reports.push_back(std::move(report));
+	}
+
+	auto output = std::ofstream(output_path);
+	::word_ladder::write_hard_pairs(reports, output);
+	if (not output) {
+		std::cerr << "could not write " << output_path << std::endl;
+		return 1;
+	}
+	std::cout << "hardest pairs written to " << output_path << std::endl;
+	return 0;
+}
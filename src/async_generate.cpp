@@ -0,0 +1,125 @@
+#include "async_generate.h"
+#include "batch_generate.h"
+// data structures
+#include <memory>
+#include <string>
+#include <vector>
+// other functionality
+#include <atomic>
+#include <exception>
+
+namespace {
+	/**
+	 * @brief runs one query into a promise, so the future it gives out holds either the ladders or
+	 * the exception the search threw
+	 *
+	 * @param from - the source word
+	 * @param to - the target word
+	 * @param graph - the graph of the supporting dictionary
+	 * @param executor - the workers the search may split its levels over
+	 * @param result - where the outcome goes
+	 */
+	auto fulfil(const std::string& from,
+	            const std::string& to,
+	            const word_ladder::graph_view& graph,
+	            word_ladder::work_stealing_executor& executor,
+	            std::promise<word_ladder::ladder_set>& result) -> void {
+		try {
+			result.set_value(word_ladder::generate_split(from, to, graph, executor));
+		} catch (...) {
+			result.set_exception(std::current_exception());
+		}
+	}
+} // namespace
+
+/**
+ * @brief queue a search on the executor. The promise is shared because tasks are std::functions,
+ * which must be copyable
+ *
+ * @param from - the source word
+ * @param to - the target word
+ * @param graph - the graph of the supporting dictionary
+ * @param executor - the workers to run on
+ * @return std::future<ladder_set> - ready once the search has finished
+ */
+auto word_ladder::generate_async(const std::string& from,
+                                 const std::string& to,
+                                 const graph_view& graph,
+                                 work_stealing_executor& executor) -> std::future<ladder_set> {
+	auto result = std::make_shared<std::promise<ladder_set>>();
+	auto future = result->get_future();
+	executor.submit([from, to, graph, &executor, result] { fulfil(from, to, graph, executor, *result); });
+	return future;
+}
+
+auto word_ladder::generate_async(const std::string& from,
+                                 const std::string& to,
+                                 const graph_view& graph,
+                                 work_stealing_executor& executor,
+                                 ladder_callback on_complete) -> void {
+	executor.submit([from, to, graph, &executor, on_complete = std::move(on_complete)] {
+		auto result = std::promise<ladder_set>{};
+		fulfil(from, to, graph, executor, result);
+		on_complete(result.get_future());
+	});
+}
+
+/**
+ * @brief queue a batch with a callback per query that stores its ladders, and fulfil the batch's
+ * promise from whichever query finishes last. The first exception any query threw is passed on
+ * instead
+ *
+ * @param queries - the pairs of source and target words
+ * @param graph - the graph of the supporting dictionary
+ * @param executor - the workers to run on
+ * @return std::future<std::vector<ladder_set>> - ready once every query has finished
+ */
+auto word_ladder::generate_batch_async(std::vector<std::pair<std::string, std::string>> queries,
+                                       const graph_view& graph,
+                                       work_stealing_executor& executor) -> std::future<std::vector<ladder_set>> {
+	struct batch {
+		std::promise<std::vector<ladder_set>> result;
+		std::vector<ladder_set> ladders;
+		std::atomic<std::size_t> remaining;
+		std::atomic_flag failed;
+	};
+	auto shared = std::make_shared<batch>();
+	shared->ladders.resize(queries.size());
+	shared->remaining = queries.size();
+	auto future = shared->result.get_future();
+	if (queries.empty()) {
+		shared->result.set_value({});
+		return future;
+	}
+	auto const collect = [shared](std::size_t index, std::future<ladder_set> done) {
+		try {
+			shared->ladders[index] = done.get();
+		} catch (...) {
+			if (not shared->failed.test_and_set()) {
+				shared->result.set_exception(std::current_exception());
+			}
+		}
+		if (--shared->remaining == 0 and not shared->failed.test()) {
+			shared->result.set_value(std::move(shared->ladders));
+		}
+	};
+	generate_batch_async(std::move(queries), graph, executor, collect);
+	return future;
+}
+
+auto word_ladder::generate_batch_async(std::vector<std::pair<std::string, std::string>> queries,
+                                       const graph_view& graph,
+                                       work_stealing_executor& executor,
+                                       batch_callback on_complete) -> void {
+	// shared so that each task carries two pointers rather than a copy of the batch
+	auto const shared_queries =
+	    std::make_shared<const std::vector<std::pair<std::string, std::string>>>(std::move(queries));
+	auto const shared_callback = std::make_shared<const batch_callback>(std::move(on_complete));
+	for (auto i = std::size_t{0}; i < shared_queries->size(); ++i) {
+		executor.submit([shared_queries, shared_callback, graph, &executor, i] {
+			auto result = std::promise<ladder_set>{};
+			fulfil((*shared_queries)[i].first, (*shared_queries)[i].second, graph, executor, result);
+			(*shared_callback)(i, result.get_future());
+		});
+	}
+}
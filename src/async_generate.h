@@ -0,0 +1,50 @@
+#ifndef COMP6771_ASYNC_GENERATE_H
+#define COMP6771_ASYNC_GENERATE_H
+
+#include "ladder_set.h"
+#include "lexicon_graph.h"
+#include "work_stealing.h"
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace word_ladder {
+	// Called on a worker once a query has finished, with a future that is already ready: get() returns
+	// the ladders or rethrows what the search threw. A callback should not block or throw; anything it
+	// throws is swallowed by the executor.
+	using ladder_callback = std::function<void(std::future<ladder_set>)>;
+	// Same, for query index of a batch.
+	using batch_callback = std::function<void(std::size_t index, std::future<ladder_set>)>;
+
+	// The asynchronous forms of generate_split. Each queues its work on the executor and returns at once,
+	// so the calling thread never waits on a search. The words are copied; the graph image and the
+	// executor must outlive the work.
+	// Preconditions: as for generate.
+	auto generate_async(const std::string& from,
+	                    const std::string& to,
+	                    const graph_view& graph,
+	                    work_stealing_executor& executor) -> std::future<ladder_set>;
+	auto generate_async(const std::string& from,
+	                    const std::string& to,
+	                    const graph_view& graph,
+	                    work_stealing_executor& executor,
+	                    ladder_callback on_complete) -> void;
+
+	// Queues every query of a batch at once, one task each, so the queries are shared out over the
+	// workers as generate_batch shares them. Entry i of the result holds the ladders of query i.
+	auto generate_batch_async(std::vector<std::pair<std::string, std::string>> queries,
+	                          const graph_view& graph,
+	                          work_stealing_executor& executor) -> std::future<std::vector<ladder_set>>;
+	// Same, calling on_complete for each query as soon as that query finishes, in whatever order they
+	// finish.
+	auto generate_batch_async(std::vector<std::pair<std::string, std::string>> queries,
+	                          const graph_view& graph,
+	                          work_stealing_executor& executor,
+	                          batch_callback on_complete) -> void;
+} // namespace word_ladder
+
+#endif // COMP6771_ASYNC_GENERATE_H
@@ -0,0 +1,88 @@
+#include "async_generate.h"
+#include "ladder_set.h"
+#include "lexicon_graph.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+#include <future>
+#include <latch>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TEST_CASE("generate_async futures hold the ladders generate_ladders finds") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto executor = ::word_ladder::work_stealing_executor(3);
+
+	auto const queries = std::vector<std::pair<std::string, std::string>>{{"atlases", "cabaret"},
+	                                                                      {"go", "if"},
+	                                                                      {"ebb", "cat"},
+	                                                                      {"work", "play"}};
+	auto futures = std::vector<std::future<::word_ladder::ladder_set>>{};
+	for (auto const& [from, to] : queries) {
+		futures.push_back(::word_ladder::generate_async(from, to, graph, executor));
+	}
+	for (auto i = std::size_t{0}; i < queries.size(); ++i) {
+		CHECK(futures[i].get().to_vectors()
+		      == ::word_ladder::generate_ladders(queries[i].first, queries[i].second, graph).to_vectors());
+	}
+
+	auto batch = ::word_ladder::generate_batch_async(queries, graph, executor);
+	auto const results = batch.get();
+	REQUIRE(results.size() == queries.size());
+	for (auto i = std::size_t{0}; i < queries.size(); ++i) {
+		CHECK(results[i].to_vectors()
+		      == ::word_ladder::generate_ladders(queries[i].first, queries[i].second, graph).to_vectors());
+	}
+	CHECK(::word_ladder::generate_batch_async({}, graph, executor).get().empty());
+}
+
+TEST_CASE("completion callbacks run on a worker once each query finishes") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto executor = ::word_ladder::work_stealing_executor(2);
+	auto const caller = std::this_thread::get_id();
+
+	// Catch2 assertions are not thread-safe, so the callbacks only record what they saw and the checks
+	// run here once the callbacks are done
+	auto single = std::promise<std::pair<std::thread::id, std::size_t>>{};
+	::word_ladder::generate_async("cat", "dog", graph, executor, [&](std::future<::word_ladder::ladder_set> done) {
+		single.set_value({std::this_thread::get_id(), done.get().size()});
+	});
+	auto const [single_thread, single_size] = single.get_future().get();
+	CHECK(single_thread != caller);
+	CHECK(single_size == ::word_ladder::generate_ladders("cat", "dog", graph).size());
+
+	auto const queries =
+	    std::vector<std::pair<std::string, std::string>>{{"code", "data"}, {"go", "if"}, {"cat", "dog"}};
+	auto mutex = std::mutex{};
+	auto sizes = std::vector<std::size_t>(queries.size());
+	auto calls = std::vector<int>(queries.size());
+	auto threads = std::vector<std::thread::id>(queries.size());
+	auto finished = std::latch(static_cast<std::ptrdiff_t>(queries.size()));
+	::word_ladder::generate_batch_async(queries,
+	                                    graph,
+	                                    executor,
+	                                    [&](std::size_t index, std::future<::word_ladder::ladder_set> done) {
+		                                    auto const ladders = done.get();
+		                                    {
+			                                    auto const lock = std::scoped_lock(mutex);
+			                                    sizes[index] = ladders.size();
+			                                    ++calls[index];
+			                                    threads[index] = std::this_thread::get_id();
+		                                    }
+		                                    finished.count_down();
+	                                    });
+	finished.wait();
+	for (auto i = std::size_t{0}; i < queries.size(); ++i) {
+		CHECK(calls[i] == 1);
+		CHECK(threads[i] != caller);
+		CHECK(sizes[i] == ::word_ladder::generate_ladders(queries[i].first, queries[i].second, graph).size());
+	}
+}
@@ -0,0 +1,140 @@
+#include "batch_generate.h"
+#include "neighbour_provider.h"
+// data structures
+#include <atomic>
+#include <string>
+#include <vector>
+// other functionality
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+
+namespace {
+	/**
+	 * @brief one distance per word id that the tasks of a search can claim at once. Each entry holds
+	 * the epoch it was written in above the distance, and an entry of an older epoch reads as
+	 * unreached, so a thread keeps one array for query after query and reset() only bumps the epoch.
+	 * The array belongs to the thread running the query; its tasks run elsewhere but finish before the
+	 * query does, and a worker waiting on them starts no other query
+	 */
+	class claimed_distances {
+	public:
+		// Forgets every distance and makes room for count of them.
+		auto reset(std::size_t count) -> void {
+			if (count > size_) {
+				entries_ = std::make_unique<std::atomic<std::uint64_t>[]>(count);
+				size_ = count;
+				epoch_ = 0;
+			}
+			++epoch_;
+			if (epoch_ == 0) {
+				for (auto i = std::size_t{0}; i < size_; ++i) {
+					entries_[i].store(0, std::memory_order_relaxed);
+				}
+				epoch_ = 1;
+			}
+		}
+		auto load(std::size_t id) const -> std::uint32_t {
+			auto const entry = entries_[id].load(std::memory_order_relaxed);
+			return entry >> 32 == epoch_ ? static_cast<std::uint32_t>(entry) : word_ladder::detail::unreached;
+		}
+		// Sets the distance of id if it is unreached and returns true, or returns false if another task
+		// got there first.
+		auto claim(std::size_t id, std::uint32_t distance) -> bool {
+			auto& entry = entries_[id];
+			auto expected = entry.load(std::memory_order_relaxed);
+			auto const claimed = std::uint64_t{epoch_} << 32 | distance;
+			return expected >> 32 != epoch_
+			       and entry.compare_exchange_strong(expected, claimed, std::memory_order_relaxed);
+		}
+
+	private:
+		std::unique_ptr<std::atomic<std::uint64_t>[]> entries_;
+		std::size_t size_ = 0;
+		std::uint32_t epoch_ = 0;
+	};
+} // namespace
+
+/**
+ * @brief function to generate all shortest word ladders over a graph, sharing the levels of the
+ * search out over an executor. The tasks of a level only ever lower a distance from unreached to the
+ * level's depth, so whichever task claims a word, its distance is the same; only which task's list it
+ * lands in differs, and the shared walk does not depend on that
+ *
+ * @param from - the source word
+ * @param to - the target word
+ * @param graph - the graph of the supporting dictionary
+ * @param executor - the workers to share levels out over
+ * @param split_size - the words of a level per task; 0 is taken as 1
+ * @return ladder_set - the list of solutions, in alphabetical order
+ */
+auto word_ladder::generate_split(const std::string& from,
+                                 const std::string& to,
+                                 const graph_view& graph,
+                                 work_stealing_executor& executor,
+                                 std::size_t split_size) -> ladder_set {
+	auto ladders = ladder_set(graph);
+	auto const source = graph.find(from);
+	auto const target = graph.find(to);
+	if (not source or not target or graph.component(*source) != graph.component(*target)) {
+		return ladders;
+	}
+	split_size = std::max<std::size_t>(split_size, 1);
+	auto const [first, last] = graph.ids_of_length(from.size());
+	thread_local auto thread_distances = claimed_distances{};
+	// named through a reference, so the tasks on other threads see this thread's array, not their own
+	auto& distances = thread_distances;
+	distances.reset(last - first);
+	distances.claim(*target - first, 0);
+
+	auto level = std::vector<std::uint32_t>{*target};
+	for (auto depth = std::uint32_t{1}; distances.load(*source - first) == detail::unreached and not level.empty();
+	     ++depth) {
+		auto const parts = (level.size() + split_size - 1) / split_size;
+		auto reached = std::vector<std::vector<std::uint32_t>>(parts);
+		auto const expand = [&](std::size_t part) {
+			auto const end = std::min(level.size(), (part + 1) * split_size);
+			for (auto k = part * split_size; k < end; ++k) {
+				for (auto const neighbour : graph.neighbours(level[k])) {
+					if (distances.claim(neighbour - first, depth)) {
+						reached[part].push_back(neighbour);
+					}
+				}
+			}
+		};
+		if (parts == 1) {
+			expand(0);
+		}
+		else {
+			executor.for_each(parts, expand);
+		}
+		level.clear();
+		for (auto const& part : reached) {
+			level.insert(level.end(), part.begin(), part.end());
+		}
+	}
+
+	auto budget = detail::unlimited_budget{};
+	auto path = std::vector<std::uint32_t>{*source};
+	detail::walk_closer(
+	    path,
+	    *target,
+	    [&](std::uint32_t id) { return graph.neighbours(id); },
+	    [&](std::uint32_t id) { return distances.load(id - first); },
+	    [&](const std::vector<std::uint32_t>& ladder) {
+		    ladders.push_back(ladder);
+		    return true;
+	    },
+	    budget);
+	return ladders;
+}
+
+auto word_ladder::generate_batch(const std::vector<std::pair<std::string, std::string>>& queries,
+                                 const graph_view& graph,
+                                 work_stealing_executor& executor) -> std::vector<ladder_set> {
+	auto results = std::vector<ladder_set>(queries.size());
+	executor.for_each(queries.size(), [&](std::size_t i) {
+		results[i] = generate_split(queries[i].first, queries[i].second, graph, executor);
+	});
+	return results;
+}
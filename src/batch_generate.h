@@ -0,0 +1,34 @@
+#ifndef COMP6771_BATCH_GENERATE_H
+#define COMP6771_BATCH_GENERATE_H
+
+#include "ladder_set.h"
+#include "lexicon_graph.h"
+#include "work_stealing.h"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace word_ladder {
+	// Same as generate_ladders, with the search of a large query split into stealable tasks. A
+	// breadth-first search backward from to labels distances one level at a time, and a level with
+	// more than split_size words is cut into tasks of split_size words that claim the words they reach
+	// with an atomic compare-and-swap. The ladders are then walked forward from from, stepping only to
+	// neighbours one rung closer, and come out in alphabetical order. A split_size of 0 is taken as 1.
+	// Preconditions: as for generate.
+	auto generate_split(const std::string& from,
+	                    const std::string& to,
+	                    const graph_view& graph,
+	                    work_stealing_executor& executor,
+	                    std::size_t split_size = 256) -> ladder_set;
+
+	// Runs every query of a batch as a task of the executor, each with generate_split, so cheap queries
+	// spread over the workers and the levels of expensive ones are shared out as well. Entry i of the
+	// result holds the ladders of query i.
+	auto generate_batch(const std::vector<std::pair<std::string, std::string>>& queries,
+	                    const graph_view& graph,
+	                    work_stealing_executor& executor) -> std::vector<ladder_set>;
+} // namespace word_ladder
+
+#endif // COMP6771_BATCH_GENERATE_H
@@ -0,0 +1,62 @@
+#include "batch_generate.h"
+#include "ladder_set.h"
+#include "lexicon_graph.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST_CASE("generate_split matches generate_ladders") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto executor = ::word_ladder::work_stealing_executor(4);
+
+	for (auto const& [from, to] : std::vector<std::pair<std::string, std::string>>{{"go", "if"},
+	                                                                              {"cat", "dog"},
+	                                                                              {"work", "play"},
+	                                                                              {"atlases", "cabaret"},
+	                                                                              {"ebb", "cat"},
+	                                                                              {"cat", "notaword"}}) {
+		auto const expected = ::word_ladder::generate_ladders(from, to, graph).to_vectors();
+		// a small split size makes every level of the long ladder several tasks
+		CHECK(::word_ladder::generate_split(from, to, graph, executor).to_vectors() == expected);
+		CHECK(::word_ladder::generate_split(from, to, graph, executor, 4).to_vectors() == expected);
+	}
+}
+
+TEST_CASE("a split size of 0 is taken as 1") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto executor = ::word_ladder::work_stealing_executor(2);
+	auto const expected = ::word_ladder::generate_ladders("work", "play", graph).to_vectors();
+	CHECK(::word_ladder::generate_split("work", "play", graph, executor, 1).to_vectors() == expected);
+	CHECK(::word_ladder::generate_split("work", "play", graph, executor, 0).to_vectors() == expected);
+}
+
+TEST_CASE("generate_batch answers every query in order") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto const queries = std::vector<std::pair<std::string, std::string>>{{"atlases", "cabaret"},
+	                                                                      {"go", "if"},
+	                                                                      {"ebb", "cat"},
+	                                                                      {"work", "play"},
+	                                                                      {"cat", "dog"},
+	                                                                      {"code", "data"}};
+	for (auto const thread_count : {std::size_t{1}, std::size_t{3}}) {
+		auto executor = ::word_ladder::work_stealing_executor(thread_count);
+		auto const results = ::word_ladder::generate_batch(queries, graph, executor);
+		REQUIRE(results.size() == queries.size());
+		for (auto i = std::size_t{0}; i < queries.size(); ++i) {
+			CHECK(results[i].to_vectors()
+			      == ::word_ladder::generate_ladders(queries[i].first, queries[i].second, graph).to_vectors());
+		}
+	}
+	auto executor = ::word_ladder::work_stealing_executor(2);
+	CHECK(::word_ladder::generate_batch({}, graph, executor).empty());
+}
@@ -0,0 +1,240 @@
+#include "dawg_lexicon.h"
+// data structures
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+// other functionality
+#include <algorithm>
+#include <cstring>
+
+namespace {
+	/**
+	 * @brief a node of the DAWG while it is being built
+	 */
+	struct build_node {
+		bool final = false;
+		std::vector<std::pair<char, std::uint32_t>> edges;
+	};
+
+	/**
+	 * @brief builds a minimal DAWG from words added in alphabetical order, minimising as it goes
+	 * (Daciuk et al., 2000). The path of the previous word is the only part of the graph that can still
+	 * change; once a word that does not extend it arrives, the nodes below the common prefix are final,
+	 * so each is either merged with an identical node already registered or registered itself. Nodes
+	 * merged away are reused, so the builder holds little more than the finished DAWG
+	 */
+	class dawg_builder {
+	public:
+		auto add(std::string_view word) -> void {
+			auto const common = static_cast<std::size_t>(
+			    std::mismatch(word.begin(), word.end(), previous_.begin(), previous_.end()).first - word.begin());
+			minimise(common);
+			for (auto i = common; i < word.size(); ++i) {
+				auto const child = new_node();
+				nodes_[path_.back()].edges.emplace_back(word[i], child);
+				path_.push_back(child);
+			}
+			nodes_[path_.back()].final = true;
+			previous_ = word;
+		}
+
+		// Minimises what is left of the last word's path and returns the nodes; the root is node 0.
+		auto finish() -> std::vector<build_node>& {
+			minimise(0);
+			return nodes_;
+		}
+
+		auto is_live(std::uint32_t node) const -> bool {
+			return not dead_[node];
+		}
+
+	private:
+		auto new_node() -> std::uint32_t {
+			if (not free_nodes_.empty()) {
+				auto const node = free_nodes_.back();
+				free_nodes_.pop_back();
+				dead_[node] = false;
+				return node;
+			}
+			nodes_.emplace_back();
+			dead_.push_back(false);
+			return static_cast<std::uint32_t>(nodes_.size() - 1);
+		}
+
+		/**
+		 * @brief a key that two nodes share exactly when they have the same finality and the same edges
+		 * to the same children, which is when their subtrees are equal, since the children are already
+		 * minimal
+		 */
+		auto signature(std::uint32_t node) const -> std::string {
+			auto key = std::string(1, nodes_[node].final ? '1' : '0');
+			for (auto const& [label, child] : nodes_[node].edges) {
+				key += label;
+				key.append(reinterpret_cast<const char*>(&child), sizeof(child));
+			}
+			return key;
+		}
+
+		auto minimise(std::size_t depth) -> void {
+			while (path_.size() - 1 > depth) {
+				auto const child = path_.back();
+				path_.pop_back();
+				auto const [registered, inserted] = register_.try_emplace(signature(child), child);
+				if (not inserted) {
+					nodes_[path_.back()].edges.back().second = registered->second;
+					nodes_[child] = build_node{};
+					dead_[child] = true;
+					free_nodes_.push_back(child);
+				}
+			}
+		}
+
+		std::vector<build_node> nodes_ = std::vector<build_node>(1);
+		std::vector<bool> dead_ = std::vector<bool>(1, false);
+		std::vector<std::uint32_t> free_nodes_;
+		std::unordered_map<std::string, std::uint32_t> register_;
+		std::vector<std::uint32_t> path_ = {0};
+		std::string previous_;
+	};
+} // namespace
+
+/**
+ * @brief build the minimal DAWG of a lexicon, then lay it out with the edges of each node side by side,
+ * numbering the nodes in breadth-first order from the root
+ *
+ * @param lexicon - the dictionary to store
+ */
+word_ladder::dawg_lexicon::dawg_lexicon(const std::unordered_set<std::string>& lexicon)
+: word_count_(lexicon.size()) {
+	auto words = std::vector<std::string_view>(lexicon.begin(), lexicon.end());
+	std::sort(words.begin(), words.end());
+	auto builder = dawg_builder{};
+	for (auto const word : words) {
+		if (word.empty()) {
+			--word_count_;
+			continue;
+		}
+		builder.add(word);
+	}
+	auto& nodes = builder.finish();
+
+	// the first edge of every node that has edges
+	auto first_edge = std::vector<std::uint32_t>(nodes.size(), no_node);
+	auto order = std::vector<std::uint32_t>{0};
+	auto edge_total = std::uint32_t{0};
+	if (not nodes.front().edges.empty()) {
+		first_edge.front() = 0;
+		edge_total = static_cast<std::uint32_t>(nodes.front().edges.size());
+	}
+	for (auto i = std::size_t{0}; i < order.size(); ++i) {
+		for (auto const& [label, child] : nodes[order[i]].edges) {
+			if (first_edge[child] == no_node and not nodes[child].edges.empty()) {
+				first_edge[child] = edge_total;
+				edge_total += static_cast<std::uint32_t>(nodes[child].edges.size());
+				order.push_back(child);
+			}
+		}
+	}
+
+	labels_.resize(edge_total);
+	flags_.resize(edge_total);
+	targets_.resize(edge_total);
+	for (auto const node : order) {
+		auto const& edges = nodes[node].edges;
+		for (auto k = std::size_t{0}; k < edges.size(); ++k) {
+			auto const [label, child] = edges[k];
+			auto const edge = first_edge[node] + k;
+			labels_[edge] = label;
+			flags_[edge] = static_cast<std::uint8_t>((nodes[child].final ? ends_word : 0)
+			                                         | (k + 1 == edges.size() ? last_edge : 0));
+			targets_[edge] = first_edge[child];
+		}
+	}
+}
+
+auto word_ladder::dawg_lexicon::contains(std::string_view word) const -> bool {
+	if (word.empty() or targets_.empty()) {
+		return false;
+	}
+	auto node = std::uint32_t{0};
+	for (auto i = std::size_t{0};; ++i) {
+		auto edge = node;
+		while (labels_[edge] != word[i]) {
+			if ((flags_[edge] & last_edge) != 0 or labels_[edge] > word[i]) {
+				return false;
+			}
+			++edge;
+		}
+		if (i + 1 == word.size()) {
+			return (flags_[edge] & ends_word) != 0;
+		}
+		node = targets_[edge];
+		if (node == no_node) {
+			return false;
+		}
+	}
+}
+
+auto word_ladder::dawg_lexicon::neighbours(std::string_view word) const -> std::vector<std::string> {
+	auto out = std::vector<std::string>{};
+	if (not word.empty() and not targets_.empty()) {
+		auto prefix = std::string{};
+		prefix.reserve(word.size());
+		walk_neighbours(0, word, prefix, false, out);
+	}
+	return out;
+}
+
+/**
+ * @brief depth-first walk of the edges of node. An edge whose letter differs from the word uses up
+ * the one substitution allowed, and after that only the edge with the word's own letter is followed.
+ * A word is found when the walk reaches the word's length on an edge that ends a word, having used
+ * the substitution
+ *
+ * @param node - the node to walk from
+ * @param word - the word to find the neighbours of
+ * @param prefix - the letters on the way to node
+ * @param substituted - whether prefix already differs from word
+ * @param out - where the neighbours are added, in alphabetical order
+ */
+auto word_ladder::dawg_lexicon::walk_neighbours(std::uint32_t node,
+                                                std::string_view word,
+                                                std::string& prefix,
+                                                bool substituted,
+                                                std::vector<std::string>& out) const -> void {
+	auto const depth = prefix.size();
+	for (auto edge = node;; ++edge) {
+		auto const differs = labels_[edge] != word[depth];
+		if (not(differs and substituted)) {
+			if (depth + 1 == word.size()) {
+				if ((differs or substituted) and (flags_[edge] & ends_word) != 0) {
+					out.push_back(prefix);
+					out.back() += labels_[edge];
+				}
+			}
+			else if (targets_[edge] != no_node) {
+				prefix.push_back(labels_[edge]);
+				walk_neighbours(targets_[edge], word, prefix, substituted or differs, out);
+				prefix.pop_back();
+			}
+		}
+		if ((flags_[edge] & last_edge) != 0) {
+			return;
+		}
+	}
+}
+
+auto word_ladder::dawg_lexicon::size() const -> std::size_t {
+	return word_count_;
+}
+
+auto word_ladder::dawg_lexicon::edge_count() const -> std::size_t {
+	return labels_.size();
+}
+
+auto word_ladder::dawg_lexicon::size_bytes() const -> std::size_t {
+	return labels_.size() * (sizeof(char) + sizeof(std::uint8_t) + sizeof(std::uint32_t));
+}
@@ -0,0 +1,51 @@
+#ifndef COMP6771_DAWG_LEXICON_H
+#define COMP6771_DAWG_LEXICON_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// A lexicon stored as a minimal DAWG (directed acyclic word graph): a trie in which every set of
+	// identical subtrees is kept once, so common suffixes such as "-ing" and "-ness" are shared as well
+	// as common prefixes. Each edge is six bytes: the letter, two flags and the index of its target
+	// node. The edges of a node are stored next to each other in alphabetical order, and a node is the
+	// index of its first edge.
+	class dawg_lexicon {
+	public:
+		explicit dawg_lexicon(const std::unordered_set<std::string>& lexicon);
+
+		auto contains(std::string_view word) const -> bool;
+		// Every word that differs from word in exactly one letter, in alphabetical order. The walk
+		// follows the trie from the root and allows one letter that differs from word on the way, so
+		// it only visits prefixes that some word of the lexicon actually has.
+		auto neighbours(std::string_view word) const -> std::vector<std::string>;
+
+		auto size() const -> std::size_t;
+		auto edge_count() const -> std::size_t;
+		// The memory the edges take up.
+		auto size_bytes() const -> std::size_t;
+
+	private:
+		static constexpr auto no_node = std::uint32_t{0xffffffff};
+		// flags of an edge
+		static constexpr auto ends_word = std::uint8_t{1}; // the path up to and including the edge is a word
+		static constexpr auto last_edge = std::uint8_t{2}; // the edge is its node's last
+
+		auto walk_neighbours(std::uint32_t node,
+		                     std::string_view word,
+		                     std::string& prefix,
+		                     bool substituted,
+		                     std::vector<std::string>& out) const -> void;
+
+		std::vector<char> labels_;
+		std::vector<std::uint8_t> flags_;
+		std::vector<std::uint32_t> targets_;
+		std::size_t word_count_ = 0;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_DAWG_LEXICON_H
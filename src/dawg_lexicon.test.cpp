@@ -0,0 +1,69 @@
+#include "dawg_lexicon.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+TEST_CASE("dawg shares common suffixes and answers membership") {
+	auto const lexicon = std::unordered_set<std::string>{"tap", "taps", "top", "tops", "a"};
+	auto const dawg = ::word_ladder::dawg_lexicon(lexicon);
+	CHECK(dawg.size() == 5);
+	// a trie would need 10 edges; tap/top share their "p" and "ps" tails
+	CHECK(dawg.edge_count() == 6);
+	for (auto const& word : lexicon) {
+		CHECK(dawg.contains(word));
+	}
+	CHECK_FALSE(dawg.contains(""));
+	CHECK_FALSE(dawg.contains("t"));
+	CHECK_FALSE(dawg.contains("ta"));
+	CHECK_FALSE(dawg.contains("tip"));
+	CHECK_FALSE(dawg.contains("tapsx"));
+	CHECK_FALSE(dawg.contains("b"));
+
+	auto const empty = ::word_ladder::dawg_lexicon({});
+	CHECK(empty.size() == 0);
+	CHECK_FALSE(empty.contains("a"));
+	CHECK(empty.neighbours("a").empty());
+}
+
+TEST_CASE("dawg neighbours differ in exactly one letter") {
+	auto const dawg = ::word_ladder::dawg_lexicon({"cat", "cot", "cut", "cog", "dot", "at", "cats", "bat"});
+	CHECK(dawg.neighbours("cot") == std::vector<std::string>{"cat", "cog", "cut", "dot"});
+	CHECK(dawg.neighbours("cat") == std::vector<std::string>{"bat", "cot", "cut"});
+	CHECK(dawg.neighbours("cap") == std::vector<std::string>{"cat"});
+	CHECK(dawg.neighbours("it") == std::vector<std::string>{"at"});
+	CHECK(dawg.neighbours("zzz").empty());
+}
+
+TEST_CASE("dawg matches the hash set on english") {
+	auto const english_lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const dawg = ::word_ladder::dawg_lexicon(english_lexicon);
+	CHECK(dawg.size() == english_lexicon.size());
+
+	auto checked = 0;
+	for (auto const& word : english_lexicon) {
+		if (++checked % 50 != 0) {
+			continue;
+		}
+		CHECK(dawg.contains(word));
+		auto expected = std::vector<std::string>{};
+		auto probe = word;
+		for (auto i = std::size_t{0}; i < probe.size(); ++i) {
+			for (auto c = 'a'; c <= 'z'; ++c) {
+				if (c != word[i]) {
+					probe[i] = c;
+					if (english_lexicon.contains(probe)) {
+						expected.push_back(probe);
+					}
+				}
+			}
+			probe[i] = word[i];
+		}
+		std::sort(expected.begin(), expected.end());
+		CHECK(dawg.neighbours(word) == expected);
+		CHECK(dawg.contains(word + "q") == english_lexicon.contains(word + "q"));
+	}
+}
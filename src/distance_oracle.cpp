@@ -0,0 +1,113 @@
+#include "distance_oracle.h"
+#include "ladder_set.h"
+#include "neighbour_provider.h"
+// data structures
+#include <string>
+#include <string_view>
+#include <vector>
+// other functionality
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief fill the matrix of every length up to max_length, one breadth-first search per row. Each
+ * search writes only its own row, so the rows of a length are filled in parallel
+ *
+ * @param graph - the graph of the supporting dictionary
+ * @param max_length - the longest words to precompute
+ * @param thread_count - the most threads to fill rows on
+ */
+word_ladder::distance_oracle::distance_oracle(graph_view graph, std::size_t max_length, std::size_t thread_count)
+: graph_(graph) {
+	matrices_.resize(std::min<std::size_t>(max_length, graph.max_length()) + 1);
+	for (auto length = std::size_t{1}; length < matrices_.size(); ++length) {
+		auto& table = matrices_[length];
+		auto const [first, last] = graph.ids_of_length(length);
+		table.first = first;
+		table.count = last - first;
+		table.distances.assign(std::size_t{table.count} * table.count, unreached);
+		parallel_for(table.count, thread_count, [&](std::size_t source) {
+			auto* row = table.distances.data() + source * table.count;
+			row[source] = 0;
+			auto level = std::vector<std::uint32_t>{static_cast<std::uint32_t>(source)};
+			auto next_level = std::vector<std::uint32_t>{};
+			for (auto depth = std::uint8_t{1}; not level.empty(); ++depth) {
+				next_level.clear();
+				for (auto const index : level) {
+					for (auto const neighbour : graph.neighbours(first + index)) {
+						if (row[neighbour - first] == unreached) {
+							if (depth == unreached) {
+								throw std::overflow_error("distance_oracle: a distance does not fit in a byte");
+							}
+							row[neighbour - first] = depth;
+							next_level.push_back(neighbour - first);
+						}
+					}
+				}
+				std::swap(level, next_level);
+			}
+		});
+	}
+}
+
+auto word_ladder::distance_oracle::graph() const -> graph_view {
+	return graph_;
+}
+
+auto word_ladder::distance_oracle::covers(std::size_t length) const -> bool {
+	return length < matrices_.size() and matrices_[length].count > 0;
+}
+
+auto word_ladder::distance_oracle::distance(std::string_view from, std::string_view to) const -> std::uint32_t {
+	return distance(*graph_.find(from), *graph_.find(to));
+}
+
+auto word_ladder::distance_oracle::distance(std::uint32_t from, std::uint32_t to) const -> std::uint32_t {
+	auto const& table = matrices_[graph_.word(from).size()];
+	auto const stored = table.distances[std::size_t{from - table.first} * table.count + (to - table.first)];
+	return stored == unreached ? unreachable_distance : stored;
+}
+
+auto word_ladder::distance_oracle::size_bytes() const -> std::size_t {
+	auto bytes = std::size_t{0};
+	for (auto const& table : matrices_) {
+		bytes += table.distances.size();
+	}
+	return bytes;
+}
+
+/**
+ * @brief function to generate all shortest word ladders using precomputed distances where there are
+ * some. A word is on a shortest ladder exactly when it is one rung closer to the target than the word
+ * before it, so the shared walk runs straight off the matrix and never expands anything else
+ *
+ * @param from - the source word
+ * @param to - the target word
+ * @param oracle - the distances, and the graph they were computed on
+ * @return std::vector<std::vector<std::string>> - the list of solutions, in alphabetical order
+ */
+auto word_ladder::generate(const std::string& from, const std::string& to, const distance_oracle& oracle)
+    -> std::vector<std::vector<std::string>> {
+	if (not oracle.covers(from.size())) {
+		return generate(from, to, oracle.graph());
+	}
+	auto const source = oracle.graph().find(from);
+	auto const target = oracle.graph().find(to);
+	if (not source or not target or oracle.distance(*source, *target) == unreachable_distance) {
+		return {};
+	}
+	auto ladders = ladder_set(oracle.graph());
+	auto budget = detail::unlimited_budget{};
+	auto path = std::vector<std::uint32_t>{*source};
+	detail::walk_closer(
+	    path,
+	    *target,
+	    [&](std::uint32_t id) { return oracle.graph().neighbours(id); },
+	    [&](std::uint32_t id) { return oracle.distance(id, *target); },
+	    [&](const std::vector<std::uint32_t>& ladder) {
+		    ladders.push_back(ladder);
+		    return true;
+	    },
+	    budget);
+	return ladders.to_vectors();
+}
@@ -0,0 +1,60 @@
+#ifndef COMP6771_DISTANCE_ORACLE_H
+#define COMP6771_DISTANCE_ORACLE_H
+
+#include "lexicon_graph.h"
+#include "parallel_for.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace word_ladder {
+	// Every shortest distance between two words of the same short length, precomputed. Lengths up to
+	// 4 have at most a few thousand words in a real lexicon (3,862 four-letter words in english.txt),
+	// so a full matrix at one byte per pair costs at most a few tens of MB, and a distance is then one
+	// lookup. The matrices are filled by a breadth-first search from every word, spread over threads.
+	// The graph image must outlive the oracle.
+	class distance_oracle {
+	public:
+		static constexpr auto default_max_length = std::size_t{4};
+
+		// Throws std::overflow_error if some distance does not fit in a byte.
+		explicit distance_oracle(graph_view graph,
+		                         std::size_t max_length = default_max_length,
+		                         std::size_t thread_count = default_thread_count());
+
+		auto graph() const -> graph_view;
+		// Whether the words of a length have a matrix.
+		auto covers(std::size_t length) const -> bool;
+		// The number of rungs between two words, or unreachable_distance if there is no ladder.
+		// Preconditions: both words are in the graph, have the same length and covers(that length).
+		auto distance(std::string_view from, std::string_view to) const -> std::uint32_t;
+		auto distance(std::uint32_t from, std::uint32_t to) const -> std::uint32_t;
+		// The memory the matrices take up.
+		auto size_bytes() const -> std::size_t;
+
+	private:
+		static constexpr auto unreached = std::uint8_t{0xff};
+
+		struct matrix {
+			std::uint32_t first = 0; // the first id of the length
+			std::uint32_t count = 0;
+			std::vector<std::uint8_t> distances; // row by row, count * count
+		};
+
+		graph_view graph_;
+		std::vector<matrix> matrices_; // indexed by length
+	};
+
+	// Same as the graph overload of generate. For a covered length the distances are known up front,
+	// so no search is needed: a depth-first walk from the start word only steps to a neighbour one rung
+	// closer to the target, which prunes every word that cannot finish a shortest ladder in the rungs
+	// left. Other lengths fall back to the graph search.
+	// Preconditions: as for generate.
+	auto generate(const std::string& from, const std::string& to, const distance_oracle& oracle)
+	    -> std::vector<std::vector<std::string>>;
+} // namespace word_ladder
+
+#endif // COMP6771_DISTANCE_ORACLE_H
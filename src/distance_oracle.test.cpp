@@ -0,0 +1,67 @@
+#include "distance_oracle.h"
+#include "lexicon_graph.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST_CASE("oracle distances are ladder lengths") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto const oracle = ::word_ladder::distance_oracle(graph);
+	CHECK(oracle.covers(2));
+	CHECK(oracle.covers(4));
+	CHECK_FALSE(oracle.covers(5));
+	CHECK(oracle.size_bytes() == 94 * 94 + 962 * 962 + 3862 * 3862);
+
+	for (auto const& [from, to] : std::vector<std::pair<std::string, std::string>>{
+	         {"go", "if"}, {"at", "it"}, {"chi", "ego"}, {"cat", "dog"}, {"work", "play"}, {"atom", "unau"}}) {
+		auto const ladders = ::word_ladder::generate(from, to, lexicon);
+		REQUIRE_FALSE(ladders.empty());
+		CHECK(oracle.distance(from, to) == ladders.front().size() - 1);
+		CHECK(oracle.distance(to, from) == oracle.distance(from, to));
+	}
+	CHECK(oracle.distance("work", "work") == 0);
+	// "ebb" has no neighbours
+	CHECK(::word_ladder::generate("ebb", "cat", lexicon).empty());
+	CHECK(oracle.distance("ebb", "cat") == ::word_ladder::unreachable_distance);
+}
+
+TEST_CASE("oracle is the same for any thread count") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto const serial = ::word_ladder::distance_oracle(graph, 3, 1);
+	auto const parallel = ::word_ladder::distance_oracle(graph, 3, 4);
+	auto const [first, last] = graph.ids_of_length(3);
+	auto differing = 0;
+	for (auto from = first; from < last; ++from) {
+		for (auto to = first; to < last; ++to) {
+			differing += parallel.distance(from, to) != serial.distance(from, to);
+		}
+	}
+	CHECK(differing == 0);
+}
+
+TEST_CASE("generate with the oracle matches the lexicon search") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const oracle = ::word_ladder::distance_oracle(::word_ladder::graph_view(image.data()));
+
+	// the last two are not covered and fall back to the graph search
+	for (auto const& [from, to] : std::vector<std::pair<std::string, std::string>>{{"go", "if"},
+	                                                                              {"chi", "ego"},
+	                                                                              {"cat", "dog"},
+	                                                                              {"work", "play"},
+	                                                                              {"atom", "unau"},
+	                                                                              {"ebb", "cat"},
+	                                                                              {"code", "code"},
+	                                                                              {"awake", "sleep"},
+	                                                                              {"atlases", "cabaret"}}) {
+		CHECK(::word_ladder::generate(from, to, oracle) == ::word_ladder::generate(from, to, lexicon));
+	}
+}
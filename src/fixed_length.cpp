@@ -0,0 +1,221 @@
+#include "fixed_length.h"
+#include "word_ladder.h"
+// data structures
+#include <array>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+// other functionality
+#include <algorithm>
+#include <functional>
+
+namespace {
+	template<std::size_t N>
+	using word_key = std::array<char, N>;
+
+	template<std::size_t N>
+	struct key_hash {
+		auto operator()(const word_key<N>& key) const noexcept -> std::size_t {
+			return std::hash<std::string_view>{}(std::string_view(key.data(), N));
+		}
+	};
+
+	template<std::size_t N>
+	using key_set = std::unordered_set<word_key<N>, key_hash<N>>;
+
+	template<typename Indexes>
+	struct length_sets;
+
+	// one key set per supported length; the I-th set holds words of I + min_length letters
+	template<std::size_t... I>
+	struct length_sets<std::index_sequence<I...>> {
+		std::tuple<key_set<I + word_ladder::fixed_length_lexicon::min_length>...> sets;
+	};
+
+	using supported_lengths = std::make_index_sequence<word_ladder::fixed_length_lexicon::max_length
+	                                                   - word_ladder::fixed_length_lexicon::min_length + 1>;
+
+	template<std::size_t N>
+	auto to_key(const std::string& word) -> word_key<N> {
+		auto key = word_key<N>{};
+		std::copy_n(word.begin(), N, key.begin());
+		return key;
+	}
+
+	/**
+	 * @brief everything the search knows about a word it has reached
+	 */
+	template<std::size_t N>
+	struct reached_word {
+		std::size_t depth;
+		std::vector<word_key<N>> parents;
+	};
+
+	template<std::size_t N>
+	using reached_map = std::unordered_map<word_key<N>, reached_word<N>, key_hash<N>>;
+
+	/**
+	 * @brief helper function to find every word one letter different from a key. N is a constant, so
+	 * the loop over positions has a fixed trip count and every candidate lives on the stack
+	 *
+	 * @param key - the base word
+	 * @param lexicon - the words of length N
+	 * @param adjacent_keys - where the adjacent words are added
+	 */
+	template<std::size_t N>
+	auto find_keys(const word_key<N>& key, const key_set<N>& lexicon, std::vector<word_key<N>>& adjacent_keys)
+	    -> void {
+		for (auto i = std::size_t{0}; i < N; ++i) {
+			auto candidate = key;
+			for (auto c = 'a'; c <= 'z'; ++c) {
+				if (c == key[i]) {
+					continue;
+				}
+				candidate[i] = c;
+				if (lexicon.contains(candidate)) {
+					adjacent_keys.push_back(candidate);
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief helper function to build every ladder ending at a key by following the parents back to the
+	 * start word, which is the only word without parents
+	 */
+	template<std::size_t N>
+	auto collect_keys(const word_key<N>& key,
+	                  const reached_map<N>& reached,
+	                  std::vector<word_key<N>>& reversed_path,
+	                  std::vector<std::vector<std::string>>& paths) -> void {
+		reversed_path.push_back(key);
+		auto const& parents = reached.at(key).parents;
+		if (parents.empty()) {
+			auto& path = paths.emplace_back();
+			for (auto i = reversed_path.rbegin(); i != reversed_path.rend(); ++i) {
+				path.emplace_back(i->begin(), i->end());
+			}
+		}
+		for (auto const& parent : parents) {
+			collect_keys(parent, reached, reversed_path, paths);
+		}
+		reversed_path.pop_back();
+	}
+
+	/**
+	 * @brief breadth-first search for ladders of N-letter words, one level at a time, keeping every
+	 * parent a word is reached from at its shortest depth
+	 *
+	 * @param from - the source word
+	 * @param to - the target word
+	 * @param lexicon - the words of length N
+	 * @return std::vector<std::vector<std::string>> - the list of solutions, in alphabetical order
+	 */
+	template<std::size_t N>
+	auto search(const std::string& from, const std::string& to, const key_set<N>& lexicon)
+	    -> std::vector<std::vector<std::string>> {
+		auto const source = to_key<N>(from);
+		auto const target = to_key<N>(to);
+		auto reached = reached_map<N>{{source, reached_word<N>{0, {}}}};
+		auto level = std::vector<word_key<N>>{source};
+		auto adjacent_keys = std::vector<word_key<N>>{};
+		for (auto depth = std::size_t{1}; not level.empty() and not reached.contains(target); ++depth) {
+			auto next_level = std::vector<word_key<N>>{};
+			for (auto const& key : level) {
+				adjacent_keys.clear();
+				find_keys<N>(key, lexicon, adjacent_keys);
+				for (auto const& adjacent_key : adjacent_keys) {
+					auto [word, inserted] = reached.try_emplace(adjacent_key, reached_word<N>{depth, {}});
+					if (inserted) {
+						next_level.push_back(adjacent_key);
+					}
+					if (word->second.depth == depth) {
+						word->second.parents.push_back(key);
+					}
+				}
+			}
+			level = std::move(next_level);
+		}
+
+		auto paths = std::vector<std::vector<std::string>>{};
+		if (reached.contains(target)) {
+			auto reversed_path = std::vector<word_key<N>>{};
+			collect_keys<N>(target, reached, reversed_path, paths);
+			std::sort(paths.begin(), paths.end());
+		}
+		return paths;
+	}
+} // namespace
+
+struct word_ladder::fixed_length_lexicon::sets {
+	length_sets<supported_lengths> fixed;
+	std::unordered_set<std::string> other;
+};
+
+/**
+ * @brief split a lexicon into one key set per supported length, plus the words of every other length
+ *
+ * @param lexicon - the dictionary to split
+ */
+word_ladder::fixed_length_lexicon::fixed_length_lexicon(const std::unordered_set<std::string>& lexicon)
+: sets_(std::make_unique<sets>()) {
+	for (auto const& word : lexicon) {
+		auto const inserted = [&]<std::size_t... I>(std::index_sequence<I...>) {
+			return ((word.size() == I + min_length
+			         and (std::get<I>(sets_->fixed.sets).insert(to_key<I + min_length>(word)), true))
+			        or ...);
+		}(supported_lengths{});
+		if (not inserted) {
+			sets_->other.insert(word);
+		}
+	}
+}
+
+word_ladder::fixed_length_lexicon::fixed_length_lexicon(fixed_length_lexicon&&) noexcept = default;
+
+auto word_ladder::fixed_length_lexicon::operator=(fixed_length_lexicon&&) noexcept -> fixed_length_lexicon& = default;
+
+word_ladder::fixed_length_lexicon::~fixed_length_lexicon() = default;
+
+auto word_ladder::fixed_length_lexicon::contains(const std::string& word) const -> bool {
+	auto found = false;
+	auto const fixed = [&]<std::size_t... I>(std::index_sequence<I...>) {
+		return ((word.size() == I + min_length
+		         and (found = std::get<I>(sets_->fixed.sets).contains(to_key<I + min_length>(word)), true))
+		        or ...);
+	}(supported_lengths{});
+	return fixed ? found : sets_->other.contains(word);
+}
+
+auto word_ladder::fixed_length_lexicon::fixed_word_count() const -> std::size_t {
+	return [&]<std::size_t... I>(std::index_sequence<I...>) {
+		return (std::get<I>(sets_->fixed.sets).size() + ...);
+	}(supported_lengths{});
+}
+
+/**
+ * @brief function to generate the list of all shortest word ladders, with the search instantiated for
+ * the length of the start word
+ *
+ * @param from - the source word
+ * @param to - the target word
+ * @param lexicon - the supporting dictionary used to generate the ladder solution(s)
+ * @return std::vector<std::vector<std::string>> - the list of solutions, in alphabetical order
+ */
+auto word_ladder::generate(const std::string& from, const std::string& to, const fixed_length_lexicon& lexicon)
+    -> std::vector<std::vector<std::string>> {
+	auto paths = std::vector<std::vector<std::string>>{};
+	auto const fixed = [&]<std::size_t... I>(std::index_sequence<I...>) {
+		return ((from.size() == I + fixed_length_lexicon::min_length
+		         and (paths = search<I + fixed_length_lexicon::min_length>(from,
+		                                                                   to,
+		                                                                   std::get<I>(lexicon.sets_->fixed.sets)),
+		              true))
+		        or ...);
+	}(supported_lengths{});
+	return fixed ? paths : generate(from, to, lexicon.sets_->other);
+}
@@ -0,0 +1,44 @@
+#ifndef COMP6771_FIXED_LENGTH_H
+#define COMP6771_FIXED_LENGTH_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// Every word of a ladder has the length of the start word, so the search for a given length can be
+	// compiled for exactly that length. This lexicon stores words of 2 to 16 letters as fixed-size
+	// std::array keys, one set per length, and generate dispatches to a search instantiated for
+	// from.size(), with fully unrolled per-letter loops and no string allocations. Other lengths use
+	// the ordinary string search.
+	class fixed_length_lexicon {
+	public:
+		static constexpr auto min_length = std::size_t{2};
+		static constexpr auto max_length = std::size_t{16};
+
+		explicit fixed_length_lexicon(const std::unordered_set<std::string>& lexicon);
+		fixed_length_lexicon(fixed_length_lexicon&&) noexcept;
+		auto operator=(fixed_length_lexicon&&) noexcept -> fixed_length_lexicon&;
+		~fixed_length_lexicon();
+
+		auto contains(const std::string& word) const -> bool;
+		// The words stored as fixed-size keys, which are those generate runs the specialised search on.
+		auto fixed_word_count() const -> std::size_t;
+
+	private:
+		struct sets;
+		friend auto generate(const std::string& from, const std::string& to, const fixed_length_lexicon& lexicon)
+		    -> std::vector<std::vector<std::string>>;
+
+		std::unique_ptr<sets> sets_;
+	};
+
+	// Same as the lexicon overload of generate, but with the search specialised for the word length.
+	// Preconditions: as for generate.
+	auto generate(const std::string& from, const std::string& to, const fixed_length_lexicon& lexicon)
+	    -> std::vector<std::vector<std::string>>;
+} // namespace word_ladder
+
+#endif // COMP6771_FIXED_LENGTH_H
@@ -0,0 +1,58 @@
+#include "fixed_length.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+TEST_CASE("fixed length lexicon keeps every word") {
+	auto const lexicon = std::unordered_set<std::string>{"a",
+	                                                     "at",
+	                                                     "cat",
+	                                                     "sixteenletterxxx",
+	                                                     "sixteenletterxxy",
+	                                                     "seventeenletterss",
+	                                                     "seventeenletterst"};
+	auto const fixed = ::word_ladder::fixed_length_lexicon(lexicon);
+	for (auto const& word : lexicon) {
+		CHECK(fixed.contains(word));
+	}
+	CHECK_FALSE(fixed.contains("it"));
+	CHECK_FALSE(fixed.contains("sixteenletterxxz"));
+	CHECK_FALSE(fixed.contains("seventeenlettersx"));
+}
+
+TEST_CASE("16 letters is the longest length with a specialised search") {
+	auto const lexicon = std::unordered_set<std::string>{"sixteenletterxxx",
+	                                                     "sixteenletterxxy",
+	                                                     "seventeenletterss",
+	                                                     "seventeenletterst"};
+	REQUIRE(std::string("sixteenletterxxx").size() == ::word_ladder::fixed_length_lexicon::max_length);
+	auto const fixed = ::word_ladder::fixed_length_lexicon(lexicon);
+	// the 16-letter words are fixed-size keys and the 17-letter words fall back to strings
+	CHECK(fixed.fixed_word_count() == 2);
+	CHECK(::word_ladder::generate("sixteenletterxxx", "sixteenletterxxy", fixed)
+	      == std::vector<std::vector<std::string>>{{"sixteenletterxxx", "sixteenletterxxy"}});
+	CHECK(::word_ladder::generate("seventeenletterss", "seventeenletterst", fixed)
+	      == std::vector<std::vector<std::string>>{{"seventeenletterss", "seventeenletterst"}});
+}
+
+TEST_CASE("fixed length generate matches generate at every length") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const fixed = ::word_ladder::fixed_length_lexicon(lexicon);
+	auto const pairs = std::vector<std::pair<std::string, std::string>>{{"at", "it"},
+	                                                                    {"fly", "dip"},
+	                                                                    {"work", "play"},
+	                                                                    {"poise", "snarl"},
+	                                                                    {"animal", "grazed"},
+	                                                                    {"running", "walking"},
+	                                                                    {"bulliest", "peppiest"},
+	                                                                    {"retelling", "derailing"},
+	                                                                    {"blistering", "swithering"},
+	                                                                    {"airplane", "tricycle"},
+	                                                                    {"collectivists", "collectivized"},
+	                                                                    {"indestructibilities", "indestructibilities"}};
+	for (auto const& [from, to] : pairs) {
+		CHECK(::word_ladder::generate(from, to, fixed) == ::word_ladder::generate(from, to, lexicon));
+	}
+	auto const one_letter = ::word_ladder::fixed_length_lexicon(std::unordered_set<std::string>{"a", "i"});
+	CHECK(::word_ladder::generate("a", "i", one_letter) == std::vector<std::vector<std::string>>{{"a", "i"}});
+}
@@ -0,0 +1,288 @@
+#include "flat_word_set.h"
+// data structures
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+// other functionality
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#ifdef __SSE2__
+#	include <emmintrin.h>
+#endif
+
+namespace {
+	// the number of control tags compared at once
+	constexpr auto group_width = std::size_t{16};
+	// tags of full slots are the low seven bits of the hash, so they are never negative
+	constexpr auto empty_tag = std::int8_t{-128};
+
+	auto mix(std::uint64_t value) -> std::uint64_t {
+		value *= std::uint64_t{0x9e3779b97f4a7c15};
+		return value ^ (value >> 32);
+	}
+
+	/**
+	 * @brief hashes a word eight letters at a time. Words are short, so most take one or two rounds
+	 *
+	 * @param word - the word to hash
+	 * @return std::uint64_t - the hash; the low seven bits become the tag, the rest pick the group
+	 */
+	auto hash_word(std::string_view word) -> std::uint64_t {
+		auto hash = mix(word.size());
+		auto i = std::size_t{0};
+		for (; i + sizeof(std::uint64_t) <= word.size(); i += sizeof(std::uint64_t)) {
+			auto chunk = std::uint64_t{0};
+			std::memcpy(&chunk, word.data() + i, sizeof(chunk));
+			hash = mix(hash ^ chunk);
+		}
+		if (i < word.size()) {
+			auto chunk = std::uint64_t{0};
+			std::memcpy(&chunk, word.data() + i, word.size() - i);
+			hash = mix(hash ^ chunk);
+		}
+		return mix(hash);
+	}
+
+	/**
+	 * @brief compares the 16 control tags of a group against one tag
+	 *
+	 * @param group - the first tag of the group
+	 * @param tag - the tag to look for
+	 * @return std::uint32_t - bit i is set if tag i of the group matches
+	 */
+	auto match(const std::int8_t* group, std::int8_t tag) -> std::uint32_t {
+#ifdef __SSE2__
+		auto const tags = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+		return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(tags, _mm_set1_epi8(tag))));
+#else
+		auto mask = std::uint32_t{0};
+		for (auto i = std::size_t{0}; i < group_width; ++i) {
+			mask |= std::uint32_t{group[i] == tag} << i;
+		}
+		return mask;
+#endif
+	}
+
+	/**
+	 * @brief helper function to find all words in the set that are one letter different from a word
+	 *
+	 * @param word - the base word
+	 * @param lexicon - the dictionary of all legal words
+	 * @param adjacent_words - cleared, then filled with the adjacent words
+	 */
+	auto find_words(std::string word,
+	                const word_ladder::flat_word_set& lexicon,
+	                std::vector<std::string>& adjacent_words) -> void {
+		adjacent_words.clear();
+		for (auto i = std::size_t{0}; i < word.size(); ++i) {
+			auto const original_char = word[i];
+			for (auto c = 'a'; c <= 'z'; ++c) {
+				if (c == original_char) {
+					continue;
+				}
+				word[i] = c;
+				if (lexicon.contains(word)) {
+					adjacent_words.push_back(word);
+				}
+			}
+			word[i] = original_char;
+		}
+	}
+
+	/**
+	 * @brief helper function to build ladders by a depth-first walk over the words on shortest ladders,
+	 * trying the next rungs in alphabetical order so the ladders come out in alphabetical order
+	 *
+	 * @param path - the ladder so far
+	 * @param on_ladder - for each depth, the words at that depth that are on a shortest ladder
+	 * @param lexicon - the dictionary of all legal words
+	 * @param paths - where the finished ladders are added
+	 */
+	auto walk_ladders(std::vector<std::string>& path,
+	                  const std::vector<word_ladder::flat_word_set>& on_ladder,
+	                  const word_ladder::flat_word_set& lexicon,
+	                  std::vector<std::vector<std::string>>& paths) -> void {
+		if (path.size() == on_ladder.size()) {
+			paths.push_back(path);
+			return;
+		}
+		auto next_rungs = std::vector<std::string>{};
+		find_words(path.back(), lexicon, next_rungs);
+		auto const& next_level = on_ladder[path.size()];
+		std::erase_if(next_rungs, [&](const std::string& word) { return not next_level.contains(word); });
+		std::sort(next_rungs.begin(), next_rungs.end());
+		for (auto& rung : next_rungs) {
+			path.push_back(std::move(rung));
+			walk_ladders(path, on_ladder, lexicon, paths);
+			path.pop_back();
+		}
+	}
+} // namespace
+
+word_ladder::flat_word_set::flat_word_set(const std::unordered_set<std::string>& words) {
+	reserve(words.size());
+	for (auto const& word : words) {
+		insert(word);
+	}
+}
+
+auto word_ladder::flat_word_set::stored(const slot& entry) const -> std::string_view {
+	return std::string_view(arena_.data() + entry.offset, entry.length);
+}
+
+/**
+ * @brief walk the groups of the word's probe sequence. In each group, only slots whose tag matches
+ * are compared in full; a group with an empty slot ends the search, since words are never removed
+ *
+ * @param word - the word to look for
+ * @param hash - its hash
+ * @return std::size_t - the slot holding the word, or the empty slot it would go in
+ */
+auto word_ladder::flat_word_set::probe(std::string_view word, std::uint64_t hash) const -> std::size_t {
+	auto const group_mask = control_.size() / group_width - 1;
+	auto const tag = static_cast<std::int8_t>(hash & 0x7f);
+	auto group = static_cast<std::size_t>(hash >> 7) & group_mask;
+	for (auto step = std::size_t{1};; ++step) {
+		auto const* tags = control_.data() + group * group_width;
+		for (auto matches = match(tags, tag); matches != 0; matches &= matches - 1) {
+			auto const index = group * group_width + static_cast<std::size_t>(std::countr_zero(matches));
+			if (stored(slots_[index]) == word) {
+				return index;
+			}
+		}
+		auto const empties = match(tags, empty_tag);
+		if (empties != 0) {
+			return group * group_width + static_cast<std::size_t>(std::countr_zero(empties));
+		}
+		// triangular steps visit every group when the group count is a power of two
+		group = (group + step) & group_mask;
+	}
+}
+
+auto word_ladder::flat_word_set::rehash(std::size_t capacity) -> void {
+	auto const old_control = std::move(control_);
+	auto const old_slots = std::move(slots_);
+	control_.assign(capacity, empty_tag);
+	slots_.assign(capacity, slot{0, 0});
+	for (auto i = std::size_t{0}; i < old_control.size(); ++i) {
+		if (old_control[i] != empty_tag) {
+			auto const hash = hash_word(stored(old_slots[i]));
+			auto const index = probe(stored(old_slots[i]), hash);
+			control_[index] = old_control[i];
+			slots_[index] = old_slots[i];
+		}
+	}
+}
+
+auto word_ladder::flat_word_set::insert(std::string_view word) -> bool {
+	if ((size_ + 1) * 8 > control_.size() * 7) {
+		rehash(std::max(control_.size() * 2, group_width));
+	}
+	auto const hash = hash_word(word);
+	auto const index = probe(word, hash);
+	if (control_[index] != empty_tag) {
+		return false;
+	}
+	control_[index] = static_cast<std::int8_t>(hash & 0x7f);
+	slots_[index] = slot{static_cast<std::uint32_t>(arena_.size()), static_cast<std::uint32_t>(word.size())};
+	arena_.insert(arena_.end(), word.begin(), word.end());
+	++size_;
+	return true;
+}
+
+auto word_ladder::flat_word_set::contains(std::string_view word) const -> bool {
+	if (size_ == 0) {
+		return false;
+	}
+	return control_[probe(word, hash_word(word))] != empty_tag;
+}
+
+auto word_ladder::flat_word_set::size() const -> std::size_t {
+	return size_;
+}
+
+auto word_ladder::flat_word_set::empty() const -> bool {
+	return size_ == 0;
+}
+
+auto word_ladder::flat_word_set::clear() -> void {
+	std::fill(control_.begin(), control_.end(), empty_tag);
+	arena_.clear();
+	size_ = 0;
+}
+
+/**
+ * @brief grow the table so that count words fit without another rehash
+ *
+ * @param count - the number of words to make room for
+ */
+auto word_ladder::flat_word_set::reserve(std::size_t count) -> void {
+	auto const capacity = std::bit_ceil(std::max(count * 8 / 7 + 1, group_width));
+	if (capacity > control_.size()) {
+		rehash(capacity);
+	}
+}
+
+/**
+ * @brief function to generate the list of all shortest word ladders. A breadth-first search records
+ * the words of each level in a flat_word_set until the target is reached; walking back from the
+ * target keeps only the words on a shortest ladder, and a depth-first walk over those from the start
+ * word emits the ladders in alphabetical order
+ *
+ * @param from - the source word
+ * @param to - the target word
+ * @param lexicon - the supporting dictionary used to generate the ladder solution(s)
+ * @return std::vector<std::vector<std::string>> - the list of solutions, in alphabetical order
+ */
+auto word_ladder::generate(const std::string& from, const std::string& to, const flat_word_set& lexicon)
+    -> std::vector<std::vector<std::string>> {
+	auto paths = std::vector<std::vector<std::string>>{};
+	auto visited = flat_word_set{};
+	auto levels = std::vector<std::vector<std::string>>{{from}};
+	auto level_sets = std::vector<flat_word_set>(1);
+	visited.insert(from);
+	level_sets.front().insert(from);
+
+	auto adjacent_words = std::vector<std::string>{};
+	while (not levels.back().empty() and not visited.contains(to)) {
+		auto next_level = std::vector<std::string>{};
+		auto next_set = flat_word_set{};
+		for (auto const& word : levels.back()) {
+			find_words(word, lexicon, adjacent_words);
+			for (auto& adjacent_word : adjacent_words) {
+				if (visited.insert(adjacent_word)) {
+					next_set.insert(adjacent_word);
+					next_level.push_back(std::move(adjacent_word));
+				}
+			}
+		}
+		levels.push_back(std::move(next_level));
+		level_sets.push_back(std::move(next_set));
+	}
+	if (not visited.contains(to)) {
+		return paths;
+	}
+
+	auto const depth = levels.size() - 1;
+	auto on_ladder = std::vector<flat_word_set>(depth + 1);
+	on_ladder[depth].insert(to);
+	auto current = std::vector<std::string>{to};
+	for (auto level = depth; level > 0; --level) {
+		auto previous = std::vector<std::string>{};
+		for (auto const& word : current) {
+			find_words(word, lexicon, adjacent_words);
+			for (auto& adjacent_word : adjacent_words) {
+				if (level_sets[level - 1].contains(adjacent_word) and on_ladder[level - 1].insert(adjacent_word)) {
+					previous.push_back(std::move(adjacent_word));
+				}
+			}
+		}
+		current = std::move(previous);
+	}
+
+	auto path = std::vector<std::string>{from};
+	walk_ladders(path, on_ladder, lexicon, paths);
+	return paths;
+}
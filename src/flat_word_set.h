@@ -0,0 +1,55 @@
+#ifndef COMP6771_FLAT_WORD_SET_H
+#define COMP6771_FLAT_WORD_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// An open-addressing hash set of short words, laid out like a SwissTable. Each slot has a one-byte
+	// control tag holding seven bits of the word's hash, and the tags of 16 slots are compared against
+	// the probe in one SSE2 instruction, so a lookup usually touches one cache line of tags and one
+	// slot. The words themselves live back to back in one character arena, so there are no per-word
+	// allocations and no pointers to chase. Words can be added but not removed; clear() empties the
+	// set but keeps its memory, which suits visited sets reused across searches.
+	class flat_word_set {
+	public:
+		flat_word_set() = default;
+		explicit flat_word_set(const std::unordered_set<std::string>& words);
+
+		// Returns true if word was not already in the set.
+		auto insert(std::string_view word) -> bool;
+		auto contains(std::string_view word) const -> bool;
+		auto size() const -> std::size_t;
+		auto empty() const -> bool;
+		auto clear() -> void;
+		auto reserve(std::size_t count) -> void;
+
+	private:
+		struct slot {
+			std::uint32_t offset;
+			std::uint32_t length;
+		};
+
+		// Returns the slot holding word, or the first empty slot on its probe sequence if it is absent.
+		auto probe(std::string_view word, std::uint64_t hash) const -> std::size_t;
+		auto rehash(std::size_t capacity) -> void;
+		auto stored(const slot& entry) const -> std::string_view;
+
+		std::vector<std::int8_t> control_;
+		std::vector<slot> slots_;
+		std::vector<char> arena_;
+		std::size_t size_ = 0;
+	};
+
+	// Same as the lexicon overload of generate, but with the lexicon and the search's visited sets held
+	// in flat_word_sets. Ladders are built in alphabetical order rather than sorted afterwards.
+	// Preconditions: as for generate.
+	auto generate(const std::string& from, const std::string& to, const flat_word_set& lexicon)
+	    -> std::vector<std::vector<std::string>>;
+} // namespace word_ladder
+
+#endif // COMP6771_FLAT_WORD_SET_H
@@ -0,0 +1,57 @@
+#include "flat_word_set.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+TEST_CASE("flat word set holds each word once") {
+	auto set = ::word_ladder::flat_word_set{};
+	CHECK(set.empty());
+	CHECK_FALSE(set.contains("cat"));
+	CHECK(set.insert("cat"));
+	CHECK(set.insert("cot"));
+	CHECK(set.insert(""));
+	CHECK_FALSE(set.insert("cat"));
+	CHECK(set.size() == 3);
+	CHECK(set.contains("cat"));
+	CHECK(set.contains(""));
+	CHECK_FALSE(set.contains("ca"));
+	CHECK_FALSE(set.contains("cats"));
+
+	set.clear();
+	CHECK(set.empty());
+	CHECK_FALSE(set.contains("cat"));
+	CHECK(set.insert("cat"));
+}
+
+TEST_CASE("flat word set agrees with unordered_set on english.txt") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const set = ::word_ladder::flat_word_set(lexicon);
+	CHECK(set.size() == lexicon.size());
+	auto missing = std::size_t{0};
+	auto false_hits = std::size_t{0};
+	for (auto const& word : lexicon) {
+		if (not set.contains(word)) {
+			++missing;
+		}
+		auto const misspelt = word + "q";
+		if (set.contains(misspelt) != lexicon.contains(misspelt)) {
+			++false_hits;
+		}
+	}
+	CHECK(missing == 0);
+	CHECK(false_hits == 0);
+}
+
+TEST_CASE("flat word set generate matches generate") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const set = ::word_ladder::flat_word_set(lexicon);
+	for (auto const& [from, to] : std::vector<std::pair<std::string, std::string>>{{"work", "play"},
+	                                                                              {"awake", "sleep"},
+	                                                                              {"poise", "snarl"},
+	                                                                              {"airplane", "tricycle"},
+	                                                                              {"cat", "cut"}}) {
+		CHECK(::word_ladder::generate(from, to, set) == ::word_ladder::generate(from, to, lexicon));
+	}
+	CHECK(::word_ladder::generate("at", "at", ::word_ladder::flat_word_set(std::unordered_set<std::string>{"at"}))
+	      == std::vector<std::vector<std::string>>{{"at"}});
+}
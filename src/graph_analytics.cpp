@@ -0,0 +1,331 @@
+#include "graph_analytics.h"
+#include "parallel_for.h"
+// data structures
+#include <string>
+#include <tuple>
+#include <vector>
+// other functionality
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+namespace {
+	constexpr auto unreached = std::numeric_limits<std::uint32_t>::max();
+
+	/**
+	 * @brief a pair of words found by a search, by index among the words of their length, first < second
+	 */
+	struct candidate {
+		std::uint32_t first;
+		std::uint32_t second;
+		std::uint32_t rungs;
+		std::uint64_t ladders;
+	};
+
+	/**
+	 * @brief the order of the longest list: more rungs first, then more ladders, then alphabetical
+	 */
+	auto longer(const candidate& a, const candidate& b) -> bool {
+		return std::tuple(b.rungs, b.ladders, a.first, a.second) < std::tuple(a.rungs, a.ladders, b.first, b.second);
+	}
+
+	/**
+	 * @brief the order of the most_ladders list: more ladders first, then more rungs, then alphabetical
+	 */
+	auto more_ladders(const candidate& a, const candidate& b) -> bool {
+		return std::tuple(b.ladders, b.rungs, a.first, a.second) < std::tuple(a.ladders, a.rungs, b.first, b.second);
+	}
+
+	/**
+	 * @brief the first top_count candidates by an order, sorted
+	 */
+	auto keep_best(std::vector<candidate>& candidates,
+	               std::size_t top_count,
+	               bool (*better)(const candidate&, const candidate&)) -> void {
+		auto const kept = static_cast<std::ptrdiff_t>(std::min(top_count, candidates.size()));
+		std::partial_sort(candidates.begin(), candidates.begin() + kept, candidates.end(), better);
+		candidates.resize(static_cast<std::size_t>(kept));
+	}
+
+	/**
+	 * @brief the hardest pairs one word makes with the words after it, by each measure
+	 */
+	struct pair_ranking {
+		std::vector<candidate> longest;
+		std::vector<candidate> most_ladders;
+	};
+
+	/**
+	 * @brief one breadth-first search over the words of one length, which also counts the shortest
+	 * ladders from the source to every word: a word's count is the sum of the counts of its neighbours
+	 * one level up
+	 */
+	class level_search {
+	public:
+		level_search(const word_ladder::graph_view& graph, std::uint32_t first, std::uint32_t count)
+		: graph_(graph)
+		, first_(first)
+		, distances_(count, unreached)
+		, ladders_(count, 0) {}
+
+		level_search(const word_ladder::graph_view& graph,
+		             std::uint32_t first,
+		             std::uint32_t count,
+		             std::uint32_t source)
+		: level_search(graph, first, count) {
+			search(source);
+		}
+
+		// searches again from another source, clearing only the words the last search reached
+		auto search(std::uint32_t source) -> void {
+			for (auto const index : order_) {
+				distances_[index] = unreached;
+				ladders_[index] = 0;
+			}
+			order_.clear();
+			level_starts_.clear();
+
+			distances_[source] = 0;
+			ladders_[source] = 1;
+			order_.push_back(source);
+			level_starts_.push_back(0);
+			for (;;) {
+				auto const end = order_.size();
+				for (auto k = level_starts_.back(); k < end; ++k) {
+					auto const index = order_[k];
+					for (auto const neighbour : graph_.neighbours(first_ + index)) {
+						auto const next = neighbour - first_;
+						if (distances_[next] == unreached) {
+							distances_[next] = distances_[index] + 1;
+							order_.push_back(next);
+						}
+						if (distances_[next] == distances_[index] + 1) {
+							auto const room = std::numeric_limits<std::uint64_t>::max() - ladders_[next];
+							ladders_[next] = ladders_[index] > room ? std::numeric_limits<std::uint64_t>::max()
+							                                        : ladders_[next] + ladders_[index];
+						}
+					}
+				}
+				if (order_.size() == end) {
+					break;
+				}
+				level_starts_.push_back(static_cast<std::uint32_t>(end));
+			}
+			level_starts_.push_back(static_cast<std::uint32_t>(order_.size()));
+		}
+
+		auto eccentricity() const -> std::uint32_t {
+			return static_cast<std::uint32_t>(level_starts_.size() - 2);
+		}
+		// the words at a distance from the source
+		auto level(std::uint32_t distance) const -> std::vector<std::uint32_t> {
+			return {order_.begin() + level_starts_[distance], order_.begin() + level_starts_[distance + 1]};
+		}
+
+		/**
+		 * @brief the pairs of the source with the words after it in its component, at most top_count
+		 * by each measure. Every pair is ranked by the search from its first word, so over all the
+		 * searches of a length each pair is ranked exactly once
+		 */
+		auto rank_pairs(std::size_t top_count) -> pair_ranking {
+			auto const source = order_.front();
+			pairs_.clear();
+			for (auto k = std::size_t{1}; k < order_.size(); ++k) {
+				if (order_[k] > source) {
+					pairs_.push_back({source, order_[k], distances_[order_[k]], ladders_[order_[k]]});
+				}
+			}
+			auto const best = [&](bool (*better)(const candidate&, const candidate&)) {
+				auto const kept = static_cast<std::ptrdiff_t>(std::min(top_count, pairs_.size()));
+				std::partial_sort(pairs_.begin(), pairs_.begin() + kept, pairs_.end(), better);
+				return std::vector<candidate>(pairs_.begin(), pairs_.begin() + kept);
+			};
+			auto longest = best(longer);
+			return {std::move(longest), best(more_ladders)};
+		}
+
+	private:
+		const word_ladder::graph_view& graph_;
+		std::uint32_t first_;
+		std::vector<std::uint32_t> distances_;
+		std::vector<std::uint64_t> ladders_;
+		std::vector<std::uint32_t> order_;
+		std::vector<std::uint32_t> level_starts_; // where each distance starts in order_, then the end
+		std::vector<candidate> pairs_; // reused by rank_pairs
+	};
+
+	/**
+	 * @brief the diameter of one component by iFUB. Fringe i of the start word bounds the diameter:
+	 * every pair of words both within distance i - 1 of it is at most 2(i - 1) apart, so once the
+	 * largest eccentricity found exceeds that, it is the diameter
+	 *
+	 * @param graph - the graph
+	 * @param first - the first id of the length
+	 * @param count - the number of words of the length
+	 * @param start - the word to split the component from, ideally a central one
+	 * @param thread_count - the most threads to run the searches of a fringe on
+	 * @param report - where the number of searches is added
+	 * @return std::uint32_t - the diameter of the component
+	 */
+	auto component_diameter(const word_ladder::graph_view& graph,
+	                        std::uint32_t first,
+	                        std::uint32_t count,
+	                        std::uint32_t start,
+	                        std::size_t thread_count,
+	                        word_ladder::length_report& report) -> std::uint32_t {
+		auto const from_start = level_search(graph, first, count, start);
+		++report.searches;
+
+		auto lower = from_start.eccentricity();
+		auto upper = 2 * lower;
+		for (auto fringe = from_start.eccentricity(); upper > lower; --fringe) {
+			auto const words = from_start.level(fringe);
+			auto eccentricities = std::vector<std::uint32_t>(words.size());
+			word_ladder::parallel_for(words.size(), thread_count, [&](std::size_t k) {
+				eccentricities[k] = level_search(graph, first, count, words[k]).eccentricity();
+			});
+			report.searches += words.size();
+			lower = std::max(lower, *std::max_element(eccentricities.begin(), eccentricities.end()));
+			upper = 2 * (fringe - 1);
+		}
+		return lower;
+	}
+
+	/**
+	 * @brief the exact hardest pairs of a length by both measures, from a counting search from every
+	 * word that has a neighbour. Each search keeps its own best pairs, which hold every pair that can
+	 * be among the best overall, and the lists are merged at the end. Each thread takes sources one at
+	 * a time and reuses one search's storage for all of them
+	 *
+	 * @param graph - the graph
+	 * @param first - the first id of the length
+	 * @param count - the number of words of the length
+	 * @param top_count - the hardest pairs to keep by each measure
+	 * @param thread_count - the most threads to search on
+	 * @return pair_ranking - the best pairs of the length, best first
+	 */
+	auto rank_all_pairs(const word_ladder::graph_view& graph,
+	                    std::uint32_t first,
+	                    std::uint32_t count,
+	                    std::size_t top_count,
+	                    std::size_t thread_count) -> pair_ranking {
+		auto rankings = std::vector<pair_ranking>(count);
+		auto next_source = std::atomic<std::uint32_t>{0};
+		word_ladder::parallel_for(std::min<std::size_t>(thread_count, count), thread_count, [&](std::size_t) {
+			auto searcher = level_search(graph, first, count);
+			for (auto source = next_source++; source < count; source = next_source++) {
+				if (not graph.neighbours(first + source).empty()) {
+					searcher.search(source);
+					rankings[source] = searcher.rank_pairs(top_count);
+				}
+			}
+		});
+		auto ranking = pair_ranking{};
+		for (auto const& each : rankings) {
+			ranking.longest.insert(ranking.longest.end(), each.longest.begin(), each.longest.end());
+			ranking.most_ladders.insert(ranking.most_ladders.end(), each.most_ladders.begin(), each.most_ladders.end());
+		}
+		keep_best(ranking.longest, top_count, longer);
+		keep_best(ranking.most_ladders, top_count, more_ladders);
+		return ranking;
+	}
+
+	/**
+	 * @brief candidates as words
+	 */
+	auto as_words(const std::vector<candidate>& candidates, const word_ladder::graph_view& graph, std::uint32_t first)
+	    -> std::vector<word_ladder::hard_pair> {
+		auto pairs = std::vector<word_ladder::hard_pair>{};
+		for (auto const& pair : candidates) {
+			pairs.push_back({std::string(graph.word(first + pair.first)),
+			                 std::string(graph.word(first + pair.second)),
+			                 pair.rungs,
+			                 pair.ladders});
+		}
+		return pairs;
+	}
+} // namespace
+
+/**
+ * @brief analyse the words of one length. For the diameter, components are taken largest first, and a
+ * component too small to beat the diameter found so far is skipped. The search that splits a component
+ * starts from its word with the most neighbours, which tends to be central. The hardest pairs are
+ * ranked separately, over every pair
+ *
+ * @param graph - the graph of the lexicon
+ * @param length - the word length to analyse
+ * @param top_count - how many hardest pairs to keep by each measure
+ * @param thread_count - the most threads to search on
+ * @return length_report - the analysis
+ */
+auto word_ladder::analyse_length(const graph_view& graph,
+                                 std::size_t length,
+                                 std::size_t top_count,
+                                 std::size_t thread_count) -> length_report {
+	auto report = length_report{};
+	report.length = length;
+	auto const [first, last] = graph.ids_of_length(length);
+	auto const count = last - first;
+	report.word_count = count;
+	if (count == 0) {
+		return report;
+	}
+
+	// the component numbers of one length are contiguous
+	auto first_component = graph.component(first);
+	for (auto id = first; id < last; ++id) {
+		first_component = std::min(first_component, graph.component(id));
+	}
+	auto members = std::vector<std::vector<std::uint32_t>>{};
+	auto degrees = std::vector<std::size_t>(count);
+	for (auto id = first; id < last; ++id) {
+		auto const component = graph.component(id) - first_component;
+		if (component >= members.size()) {
+			members.resize(component + 1);
+		}
+		members[component].push_back(id - first);
+		degrees[id - first] = graph.neighbours(id).size();
+		report.edge_count += degrees[id - first];
+		if (degrees[id - first] >= report.degree_histogram.size()) {
+			report.degree_histogram.resize(degrees[id - first] + 1);
+		}
+		++report.degree_histogram[degrees[id - first]];
+	}
+	report.edge_count /= 2;
+	std::stable_sort(members.begin(), members.end(), [](auto const& a, auto const& b) { return a.size() > b.size(); });
+	for (auto const& component : members) {
+		if (not component.empty()) {
+			report.component_sizes.push_back(component.size());
+		}
+	}
+
+	for (auto const& component : members) {
+		if (component.size() <= std::size_t{report.diameter} + 1) {
+			break;
+		}
+		auto const start = *std::max_element(component.begin(), component.end(), [&](std::uint32_t a, std::uint32_t b) {
+			return degrees[a] < degrees[b];
+		});
+		auto const diameter = component_diameter(graph, first, count, start, thread_count, report);
+		report.diameter = std::max(report.diameter, diameter);
+	}
+
+	auto const ranking = rank_all_pairs(graph, first, count, top_count, thread_count);
+	report.longest = as_words(ranking.longest, graph, first);
+	report.most_ladders = as_words(ranking.most_ladders, graph, first);
+	return report;
+}
+
+auto word_ladder::write_hard_pairs(const std::vector<length_report>& reports, std::ostream& out) -> void {
+	out << "length\tfrom\tto\trungs\tladders\tlist\n";
+	for (auto const& report : reports) {
+		auto const write = [&](const std::vector<hard_pair>& pairs, const char* list) {
+			for (auto const& pair : pairs) {
+				out << report.length << '\t' << pair.from << '\t' << pair.to << '\t' << pair.rungs << '\t'
+				    << pair.ladders << '\t' << list << '\n';
+			}
+		};
+		write(report.longest, "longest");
+		write(report.most_ladders, "most_ladders");
+	}
+}
@@ -0,0 +1,54 @@
+#ifndef COMP6771_GRAPH_ANALYTICS_H
+#define COMP6771_GRAPH_ANALYTICS_H
+
+#include "lexicon_graph.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace word_ladder {
+	// Two words of the same length and the shortest ladders between them.
+	struct hard_pair {
+		std::string from;
+		std::string to;
+		std::uint32_t rungs;
+		std::uint64_t ladders; // saturates at the largest std::uint64_t
+	};
+
+	// The shape of the graph of one word length.
+	struct length_report {
+		std::size_t length = 0;
+		std::size_t word_count = 0;
+		std::size_t edge_count = 0; // each pair of neighbours once
+		std::vector<std::size_t> component_sizes; // largest first
+		std::vector<std::size_t> degree_histogram; // entry d is the number of words with d neighbours
+		// The longest shortest ladder between two words of the length, in rungs. Exact.
+		std::uint32_t diameter = 0;
+		// How many breadth-first searches finding the diameter took.
+		std::size_t searches = 0;
+		// The pairs with the longest ladders and the pairs with the most shortest ladders, over every
+		// pair of the length. The first longest pair is always at the diameter.
+		std::vector<hard_pair> longest;
+		std::vector<hard_pair> most_ladders;
+	};
+
+	// Analyses the words of one length: their components, degrees and diameter, and the hardest pairs.
+	// The diameter of every component is found with iFUB (Crescenzi et al., 2013): a search from a
+	// central word splits the component into fringes by distance, and the eccentricities of the
+	// farthest fringes bound the diameter from below while the fringe distance bounds it from above,
+	// so usually only a handful of searches are needed instead of one per word. The hardest pairs
+	// still need a counting search from every word, since a pair with many ladders need not be far
+	// apart. The searches run on up to thread_count threads; the report is the same for any count.
+	auto analyse_length(const graph_view& graph, std::size_t length, std::size_t top_count, std::size_t thread_count)
+	    -> length_report;
+
+	// Writes the hardest pairs of every report as tab-separated lines of length, from, to, rungs,
+	// ladders and the list the pair is in ("longest" or "most_ladders"), under a header line, for use
+	// as a benchmark corpus.
+	auto write_hard_pairs(const std::vector<length_report>& reports, std::ostream& out) -> void;
+} // namespace word_ladder
+
+#endif // COMP6771_GRAPH_ANALYTICS_H
@@ -0,0 +1,150 @@
+#include "graph_analytics.h"
+#include "distance_oracle.h"
+#include "lexicon_graph.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+TEST_CASE("analysis of a small lexicon") {
+	// cat - cot - cog - dog - dig is a path, bat hangs off cat, and ebb and emu are alone
+	auto const lexicon = std::unordered_set<std::string>{"cat", "cot", "cog", "dog", "dig", "bat", "ebb", "emu"};
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto const report = ::word_ladder::analyse_length(graph, 3, 2, 1);
+
+	CHECK(report.word_count == 8);
+	CHECK(report.edge_count == 5);
+	CHECK(report.component_sizes == std::vector<std::size_t>{6, 1, 1});
+	CHECK(report.degree_histogram == std::vector<std::size_t>{2, 2, 4});
+	CHECK(report.diameter == 5);
+	REQUIRE(report.longest.size() == 2);
+	CHECK(report.longest.front().from == "bat");
+	CHECK(report.longest.front().to == "dig");
+	CHECK(report.longest.front().rungs == 5);
+	CHECK(report.longest.front().ladders == 1);
+
+	auto const empty = ::word_ladder::analyse_length(graph, 5, 2, 1);
+	CHECK(empty.word_count == 0);
+	CHECK(empty.diameter == 0);
+}
+
+TEST_CASE("diameters match all pairs on short english words") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto const oracle = ::word_ladder::distance_oracle(graph, 3);
+
+	for (auto length = std::size_t{2}; length <= 3; ++length) {
+		auto const [first, last] = graph.ids_of_length(length);
+		auto diameter = std::uint32_t{0};
+		for (auto from = first; from < last; ++from) {
+			for (auto to = first; to < last; ++to) {
+				if (oracle.distance(from, to) != ::word_ladder::unreachable_distance) {
+					diameter = std::max(diameter, oracle.distance(from, to));
+				}
+			}
+		}
+		auto const serial = ::word_ladder::analyse_length(graph, length, 5, 1);
+		auto const parallel = ::word_ladder::analyse_length(graph, length, 5, 4);
+		CHECK(serial.diameter == diameter);
+		CHECK(serial.searches < serial.word_count);
+		CHECK(parallel.diameter == serial.diameter);
+		CHECK(parallel.searches == serial.searches);
+
+		REQUIRE_FALSE(serial.longest.empty());
+		CHECK(serial.longest.front().rungs == diameter);
+		for (auto const& pair : serial.longest) {
+			auto const ladders = ::word_ladder::generate(pair.from, pair.to, lexicon);
+			CHECK(ladders.size() == pair.ladders);
+			CHECK(ladders.front().size() == pair.rungs + 1);
+		}
+		for (auto const& pair : serial.most_ladders) {
+			CHECK(::word_ladder::generate(pair.from, pair.to, lexicon).size() == pair.ladders);
+		}
+	}
+}
+
+TEST_CASE("hard pairs match a count over all pairs on short english words") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto const oracle = ::word_ladder::distance_oracle(graph, 3);
+	// from, to, rungs and ladders, with the words as ids, which are alphabetical within a length
+	using pair = std::tuple<std::uint32_t, std::uint32_t, std::uint32_t, std::uint64_t>;
+	using words = std::tuple<std::string, std::string, std::uint32_t, std::uint64_t>;
+	auto const as_tuples = [](const std::vector<::word_ladder::hard_pair>& pairs) {
+		auto tuples = std::vector<words>{};
+		for (auto const& each : pairs) {
+			tuples.emplace_back(each.from, each.to, each.rungs, each.ladders);
+		}
+		return tuples;
+	};
+
+	for (auto length = std::size_t{2}; length <= 3; ++length) {
+		auto const [first, last] = graph.ids_of_length(length);
+		// ladders to each target, from the words nearest it outwards
+		auto pairs = std::vector<pair>{};
+		for (auto to = first; to < last; ++to) {
+			auto distances = std::vector<std::uint32_t>(last - first);
+			auto by_distance = std::vector<std::uint32_t>{};
+			for (auto from = first; from < last; ++from) {
+				distances[from - first] = oracle.distance(from, to);
+				if (distances[from - first] != ::word_ladder::unreachable_distance) {
+					by_distance.push_back(from);
+				}
+			}
+			std::stable_sort(by_distance.begin(), by_distance.end(), [&](std::uint32_t a, std::uint32_t b) {
+				return distances[a - first] < distances[b - first];
+			});
+			auto ladders = std::vector<std::uint64_t>(last - first);
+			ladders[to - first] = 1;
+			for (auto const from : by_distance) {
+				for (auto const neighbour : graph.neighbours(from)) {
+					if (distances[neighbour - first] + 1 == distances[from - first]) {
+						ladders[from - first] += ladders[neighbour - first];
+					}
+				}
+				if (from < to) {
+					pairs.emplace_back(from, to, distances[from - first], ladders[from - first]);
+				}
+			}
+		}
+
+		auto const report = ::word_ladder::analyse_length(graph, length, 5, 2);
+		auto const rank = [&](auto key) {
+			std::partial_sort(pairs.begin(), pairs.begin() + 5, pairs.end(), [&](pair const& a, pair const& b) {
+				return key(a) < key(b);
+			});
+			auto best = std::vector<words>{};
+			for (auto const& [from, to, rungs, ladders] : std::vector<pair>(pairs.begin(), pairs.begin() + 5)) {
+				best.emplace_back(graph.word(from), graph.word(to), rungs, ladders);
+			}
+			return best;
+		};
+		CHECK(as_tuples(report.most_ladders) == rank([](pair const& p) {
+			      return std::tuple(~std::get<3>(p), ~std::get<2>(p), std::get<0>(p), std::get<1>(p));
+		      }));
+		CHECK(as_tuples(report.longest) == rank([](pair const& p) {
+			      return std::tuple(~std::get<2>(p), ~std::get<3>(p), std::get<0>(p), std::get<1>(p));
+		      }));
+	}
+}
+
+TEST_CASE("hard pairs export as tab-separated lines") {
+	auto report = ::word_ladder::length_report{};
+	report.length = 3;
+	report.longest = {{"bat", "dig", 5, 1}};
+	report.most_ladders = {{"cat", "dog", 3, 2}};
+	auto out = std::ostringstream{};
+	::word_ladder::write_hard_pairs({report}, out);
+	CHECK(out.str()
+	      == "length\tfrom\tto\trungs\tladders\tlist\n"
+	         "3\tbat\tdig\t5\t1\tlongest\n"
+	         "3\tcat\tdog\t3\t2\tmost_ladders\n");
+}
@@ -0,0 +1,240 @@
+#include "graph_placement.h"
+// data structures
+#include <string>
+#include <vector>
+// memory placement
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+// other functionality
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <system_error>
+#include <utility>
+
+namespace {
+	constexpr auto huge_page_size = std::size_t{2} << 20;
+	// mbind takes node masks of whole longs
+	constexpr auto node_mask_bits = sizeof(unsigned long) * 8;
+
+	[[noreturn]] auto throw_errno(const std::string& what) -> void {
+		throw std::system_error(errno, std::generic_category(), what);
+	}
+
+	/**
+	 * @brief maps anonymous memory for a graph, aligned and advised for the page mode
+	 *
+	 * @param bytes - the size of the graph
+	 * @param pages - the pages to map it with
+	 * @param length - where the length actually mapped is written, for munmap
+	 * @return void* - the mapping
+	 */
+	auto map_pages(std::size_t bytes, word_ladder::page_mode pages, std::size_t& length) -> void* {
+		if (pages == word_ladder::page_mode::normal) {
+			length = bytes;
+			auto* const address = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (address == MAP_FAILED) {
+				throw_errno("mmap");
+			}
+			return address;
+		}
+		length = (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+		if (pages == word_ladder::page_mode::explicit_huge) {
+			auto* const address =
+			    ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+			if (address == MAP_FAILED) {
+				throw_errno("mmap MAP_HUGETLB");
+			}
+			return address;
+		}
+		// a huge page has to start on a 2 MiB boundary, so map one more and trim both ends
+		auto* const mapped = static_cast<std::byte*>(
+		    ::mmap(nullptr, length + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+		if (static_cast<void*>(mapped) == MAP_FAILED) {
+			throw_errno("mmap");
+		}
+		auto const skip = (huge_page_size - reinterpret_cast<std::uintptr_t>(mapped) % huge_page_size) % huge_page_size;
+		if (skip != 0) {
+			::munmap(mapped, skip);
+		}
+		::munmap(mapped + skip + length, huge_page_size - skip);
+		if (::madvise(mapped + skip, length, MADV_HUGEPAGE) != 0) {
+			auto const error = errno;
+			::munmap(mapped + skip, length);
+			errno = error;
+			throw_errno("madvise MADV_HUGEPAGE");
+		}
+		return mapped + skip;
+	}
+
+	/**
+	 * @brief sets the NUMA policy of a mapping before any of it is touched, so its pages are placed by
+	 * the policy as they are first written
+	 *
+	 * @param address - the mapping
+	 * @param length - its length
+	 * @param policy - MPOL_INTERLEAVE or MPOL_BIND
+	 * @param nodes - the nodes the policy may use
+	 */
+	auto bind_pages(void* address, std::size_t length, int policy, const std::vector<std::size_t>& nodes) -> void {
+		auto mask = std::vector<unsigned long>(1);
+		for (auto const node : nodes) {
+			if (node / node_mask_bits >= mask.size()) {
+				mask.resize(node / node_mask_bits + 1);
+			}
+			mask[node / node_mask_bits] |= 1UL << (node % node_mask_bits);
+		}
+		// maxnode counts one past the highest bit the kernel reads
+		if (::syscall(SYS_mbind, address, length, policy, mask.data(), mask.size() * node_mask_bits + 1, 0) != 0) {
+			throw_errno("mbind");
+		}
+	}
+
+	/**
+	 * @brief the node the calling thread is running on
+	 */
+	auto current_node() -> std::size_t {
+		auto cpu = 0U;
+		auto node = 0U;
+		if (::syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+			return 0;
+		}
+		return node;
+	}
+
+	/**
+	 * @brief reads a sysfs node list such as "0-1,4"
+	 *
+	 * @param path - the file holding the list
+	 * @return std::vector<std::size_t> - the node ids in it, in order; empty if the file cannot be read
+	 */
+	auto read_node_list(const char* path) -> std::vector<std::size_t> {
+		auto nodes = std::vector<std::size_t>{};
+		auto in = std::ifstream(path);
+		auto range = std::string{};
+		while (std::getline(in, range, ',')) {
+			auto low = std::size_t{0};
+			auto const* const end = range.data() + range.size();
+			auto const parsed = std::from_chars(range.data(), end, low);
+			if (parsed.ec != std::errc{}) {
+				continue;
+			}
+			auto high = low;
+			if (parsed.ptr != end and *parsed.ptr == '-'
+			    and std::from_chars(parsed.ptr + 1, end, high).ec != std::errc{}) {
+				continue;
+			}
+			for (auto node = low; node <= high; ++node) {
+				nodes.push_back(node);
+			}
+		}
+		return nodes;
+	}
+} // namespace
+
+/**
+ * @brief reads the nodes with memory from sysfs. Node ids need not be contiguous, and a node may have
+ * only CPUs, so neither the highest id nor the online list says where memory can be bound
+ *
+ * @return std::vector<std::size_t> - the node ids, falling back to the online nodes and then to node 0
+ */
+auto word_ladder::numa_nodes() -> std::vector<std::size_t> {
+	auto nodes = read_node_list("/sys/devices/system/node/has_memory");
+	if (nodes.empty()) {
+		nodes = read_node_list("/sys/devices/system/node/online");
+	}
+	if (nodes.empty()) {
+		nodes.push_back(0);
+	}
+	return nodes;
+}
+
+auto word_ladder::numa_node_count() -> std::size_t {
+	return numa_nodes().size();
+}
+
+/**
+ * @brief map memory for each copy, set its NUMA policy while it is still untouched, copy the image in
+ * and make it read-only
+ *
+ * @param graph - the image to copy
+ * @param options - where to put the copies
+ */
+word_ladder::placed_graph::placed_graph(const graph_view& graph, placement_options options)
+: options_(options) {
+	auto const nodes = numa_nodes();
+	auto const copies = options.numa == numa_mode::replicate ? nodes.size() : std::size_t{1};
+	try {
+		for (auto replica = std::size_t{0}; replica < copies; ++replica) {
+			auto length = std::size_t{0};
+			auto* const address = map_pages(graph.size_bytes(), options.pages, length);
+			replicas_.push_back({address, length, nodes[replica]});
+			if (options.numa == numa_mode::interleave) {
+				bind_pages(address, length, MPOL_INTERLEAVE, nodes);
+			}
+			else if (options.numa == numa_mode::replicate) {
+				bind_pages(address, length, MPOL_BIND, {nodes[replica]});
+			}
+			std::memcpy(address, graph.data(), graph.size_bytes());
+			if (::mprotect(address, length, PROT_READ) != 0) {
+				throw_errno("mprotect");
+			}
+		}
+	} catch (...) {
+		release();
+		throw;
+	}
+}
+
+word_ladder::placed_graph::placed_graph(placed_graph&& other) noexcept
+: replicas_(std::exchange(other.replicas_, {}))
+, options_(other.options_) {}
+
+auto word_ladder::placed_graph::operator=(placed_graph&& other) noexcept -> placed_graph& {
+	if (this != &other) {
+		release();
+		replicas_ = std::exchange(other.replicas_, {});
+		options_ = other.options_;
+	}
+	return *this;
+}
+
+word_ladder::placed_graph::~placed_graph() {
+	release();
+}
+
+auto word_ladder::placed_graph::release() noexcept -> void {
+	for (auto const& replica : replicas_) {
+		::munmap(replica.address, replica.length);
+	}
+	replicas_.clear();
+}
+
+auto word_ladder::placed_graph::options() const -> placement_options {
+	return options_;
+}
+
+auto word_ladder::placed_graph::replica_count() const -> std::size_t {
+	return replicas_.size();
+}
+
+auto word_ladder::placed_graph::view() const -> graph_view {
+	if (replicas_.size() == 1) {
+		return view(0);
+	}
+	// a thread on a node without memory reads the first copy
+	auto const node = current_node();
+	auto const replica = std::find_if(replicas_.begin(), replicas_.end(), [&](const mapping& each) {
+		return each.node == node;
+	});
+	return view(replica == replicas_.end() ? 0 : static_cast<std::size_t>(replica - replicas_.begin()));
+}
+
+auto word_ladder::placed_graph::view(std::size_t replica) const -> graph_view {
+	return graph_view(static_cast<const std::byte*>(replicas_[replica].address));
+}
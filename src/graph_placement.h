@@ -0,0 +1,71 @@
+#ifndef COMP6771_GRAPH_PLACEMENT_H
+#define COMP6771_GRAPH_PLACEMENT_H
+
+#include "lexicon_graph.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace word_ladder {
+	// The pages a placed graph is held in.
+	enum class page_mode {
+		normal, // the default 4 KiB pages
+		transparent_huge, // 2 MiB aligned and advised with MADV_HUGEPAGE; the kernel may still use small pages
+		explicit_huge, // MAP_HUGETLB, from the reserved huge page pool
+	};
+
+	// How a placed graph is spread over NUMA nodes.
+	enum class numa_mode {
+		none, // wherever the kernel puts it, usually the node of the thread that copies it
+		interleave, // pages round-robin over every node with memory, so no node's memory bus carries all the reads
+		replicate, // one copy on every node with memory; each reader uses the copy of the node it runs on
+	};
+
+	struct placement_options {
+		page_mode pages = page_mode::normal;
+		numa_mode numa = numa_mode::none;
+	};
+
+	// The NUMA nodes of this machine that have memory, by id; just node 0 if it does not say.
+	auto numa_nodes() -> std::vector<std::size_t>;
+	// The number of NUMA nodes with memory; 1 if the machine does not say.
+	auto numa_node_count() -> std::size_t;
+
+	// A read-only copy of a graph image in memory placed for many reader threads. Large graphs spend
+	// much of a search on TLB misses, which huge pages cut by mapping 512 times as much memory per
+	// entry, and on a multi-socket machine on reads from another node's memory, which interleaving
+	// spreads out and replication removes. Placement uses mmap, madvise and the mbind system call
+	// directly, so it needs no NUMA library.
+	class placed_graph {
+	public:
+		// Throws std::system_error if the memory cannot be mapped or placed as asked, for instance
+		// explicit huge pages with an empty pool or NUMA placement where mbind is not permitted.
+		placed_graph(const graph_view& graph, placement_options options);
+		placed_graph(placed_graph&& other) noexcept;
+		auto operator=(placed_graph&& other) noexcept -> placed_graph&;
+		placed_graph(const placed_graph&) = delete;
+		auto operator=(const placed_graph&) -> placed_graph& = delete;
+		~placed_graph();
+
+		auto options() const -> placement_options;
+		// One copy per NUMA node with memory when replicated, otherwise one.
+		auto replica_count() const -> std::size_t;
+		// The copy for the node the calling thread is running on.
+		auto view() const -> graph_view;
+		auto view(std::size_t replica) const -> graph_view;
+
+	private:
+		struct mapping {
+			void* address;
+			std::size_t length;
+			std::size_t node; // the node the copy is bound to when replicated
+		};
+
+		auto release() noexcept -> void;
+
+		std::vector<mapping> replicas_;
+		placement_options options_;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_GRAPH_PLACEMENT_H
@@ -0,0 +1,53 @@
+#include "graph_placement.h"
+#include "lexicon_graph.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <system_error>
+#include <vector>
+
+TEST_CASE("a placed graph is the same graph in every mode") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto const expected = ::word_ladder::generate("work", "play", graph);
+	auto const nodes = ::word_ladder::numa_nodes();
+	CHECK(nodes.size() == ::word_ladder::numa_node_count());
+	CHECK(std::is_sorted(nodes.begin(), nodes.end()));
+	CHECK(std::adjacent_find(nodes.begin(), nodes.end()) == nodes.end());
+
+	for (auto const pages : {::word_ladder::page_mode::normal, ::word_ladder::page_mode::transparent_huge}) {
+		for (auto const numa : {::word_ladder::numa_mode::none,
+		                        ::word_ladder::numa_mode::interleave,
+		                        ::word_ladder::numa_mode::replicate}) {
+			auto placed = ::word_ladder::placed_graph(graph, {pages, numa});
+			CHECK(placed.replica_count()
+			      == (numa == ::word_ladder::numa_mode::replicate ? ::word_ladder::numa_node_count() : 1));
+			for (auto replica = std::size_t{0}; replica < placed.replica_count(); ++replica) {
+				auto const copy = placed.view(replica);
+				REQUIRE(copy.size_bytes() == graph.size_bytes());
+				CHECK(std::memcmp(copy.data(), graph.data(), graph.size_bytes()) == 0);
+			}
+			CHECK(::word_ladder::generate("work", "play", placed.view()) == expected);
+
+			auto moved = std::move(placed);
+			CHECK(moved.options().pages == pages);
+			CHECK(::word_ladder::generate("work", "play", moved.view()) == expected);
+		}
+	}
+}
+
+TEST_CASE("explicit huge pages come from the reserved pool or fail cleanly") {
+	auto const image = ::word_ladder::build_graph_image({"cat", "cot", "dog"});
+	auto const graph = ::word_ladder::graph_view(image.data());
+	try {
+		auto const placed = ::word_ladder::placed_graph(graph, {::word_ladder::page_mode::explicit_huge, {}});
+		CHECK(std::memcmp(placed.view().data(), graph.data(), graph.size_bytes()) == 0);
+	} catch (const std::system_error& error) {
+		// no huge pages reserved on this machine
+		CHECK(error.code().value() != 0);
+	}
+}
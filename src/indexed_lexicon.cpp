@@ -0,0 +1,332 @@
+#include "indexed_lexicon.h"
+#include "neighbour_provider.h"
+// data structures
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+// other functionality
+#include <algorithm>
+#include <utility>
+
+namespace {
+	/**
+	 * @brief removes one occurrence of a value from an unordered list by moving the last element into
+	 * its place
+	 *
+	 * @param values - the list
+	 * @param value - the value to remove, which must be in the list
+	 */
+	auto swap_remove(std::vector<std::uint32_t>& values, std::uint32_t value) -> void {
+		auto const position = std::find(values.begin(), values.end(), value);
+		*position = values.back();
+		values.pop_back();
+	}
+} // namespace
+
+word_ladder::indexed_lexicon::indexed_lexicon(const std::unordered_set<std::string>& lexicon) {
+	ids_.reserve(lexicon.size());
+	for (auto const& word : lexicon) {
+		add_word(word);
+	}
+}
+
+auto word_ladder::indexed_lexicon::new_label() -> std::uint32_t {
+	if (not free_labels_.empty()) {
+		auto const label = free_labels_.back();
+		free_labels_.pop_back();
+		return label;
+	}
+	members_.emplace_back();
+	return static_cast<std::uint32_t>(members_.size() - 1);
+}
+
+auto word_ladder::indexed_lexicon::join(std::uint32_t member, std::uint32_t label) -> void {
+	labels_[member] = label;
+	member_positions_[member] = static_cast<std::uint32_t>(members_[label].size());
+	members_[label].push_back(member);
+}
+
+auto word_ladder::indexed_lexicon::leave(std::uint32_t member) -> void {
+	auto& members = members_[labels_[member]];
+	auto const moved = members.back();
+	members[member_positions_[member]] = moved;
+	member_positions_[moved] = member_positions_[member];
+	members.pop_back();
+	if (members.empty()) {
+		free_labels_.push_back(labels_[member]);
+	}
+}
+
+/**
+ * @brief merge two components by relabelling the members of the smaller one, so a word is relabelled
+ * at most log n times however the lexicon grows
+ *
+ * @param label1 - one component
+ * @param label2 - the other component
+ */
+auto word_ladder::indexed_lexicon::merge(std::uint32_t label1, std::uint32_t label2) -> void {
+	if (members_[label1].size() < members_[label2].size()) {
+		std::swap(label1, label2);
+	}
+	auto moving = std::move(members_[label2]);
+	members_[label2].clear();
+	free_labels_.push_back(label2);
+	for (auto const member : moving) {
+		join(member, label1);
+	}
+}
+
+/**
+ * @brief add a word: link it to the other members of its wildcard buckets, then merge the components
+ * of its new neighbours into one
+ *
+ * @param word - the word to add
+ * @return bool - true if the word was added, false if it was already in the lexicon
+ */
+auto word_ladder::indexed_lexicon::add_word(const std::string& word) -> bool {
+	if (ids_.contains(word)) {
+		return false;
+	}
+	auto id = static_cast<std::uint32_t>(words_.size());
+	if (free_ids_.empty()) {
+		words_.emplace_back();
+		adjacency_.emplace_back();
+		labels_.push_back(0);
+		member_positions_.push_back(0);
+	}
+	else {
+		id = free_ids_.back();
+		free_ids_.pop_back();
+	}
+	words_[id] = word;
+	ids_.emplace(word, id);
+
+	auto key = word;
+	for (auto i = std::size_t{0}; i < word.size(); ++i) {
+		key[i] = '*';
+		auto& bucket = buckets_[key];
+		for (auto const other : bucket) {
+			adjacency_[id].push_back(other);
+			adjacency_[other].push_back(id);
+		}
+		bucket.push_back(id);
+		key[i] = word[i];
+	}
+
+	join(id, new_label());
+	for (auto const neighbour : adjacency_[id]) {
+		if (labels_[neighbour] != labels_[id]) {
+			merge(labels_[neighbour], labels_[id]);
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief remove a word: unlink it from its buckets and neighbours, then check whether its component
+ * split
+ *
+ * @param word - the word to remove
+ * @return bool - true if the word was removed, false if it was not in the lexicon
+ */
+auto word_ladder::indexed_lexicon::remove_word(const std::string& word) -> bool {
+	auto const found = ids_.find(word);
+	if (found == ids_.end()) {
+		return false;
+	}
+	auto const id = found->second;
+	ids_.erase(found);
+
+	auto key = word;
+	for (auto i = std::size_t{0}; i < word.size(); ++i) {
+		key[i] = '*';
+		auto& bucket = buckets_.at(key);
+		swap_remove(bucket, id);
+		if (bucket.empty()) {
+			buckets_.erase(key);
+		}
+		key[i] = word[i];
+	}
+	auto former_neighbours = std::move(adjacency_[id]);
+	adjacency_[id].clear();
+	for (auto const neighbour : former_neighbours) {
+		swap_remove(adjacency_[neighbour], id);
+	}
+
+	leave(id);
+	words_[id].clear();
+	free_ids_.push_back(id);
+	split(std::move(former_neighbours));
+	return true;
+}
+
+/**
+ * @brief after a word is removed, its former neighbours are either still connected or its component
+ * has split into pieces, each holding some of them. A breadth-first search starts from every former
+ * neighbour, and the searches take turns expanding one word each. Searches that meet are in the same
+ * piece and carry on as one group; a group that runs out of words before meeting the others has found
+ * a whole piece, which gets a new label. Once a single group is left it keeps the old label, so the
+ * work done is about the number of searches times the size of the pieces other than the largest,
+ * and when nothing splits the searches stop as soon as they have all met
+ *
+ * @param former_neighbours - the words that were adjacent to the removed word
+ */
+auto word_ladder::indexed_lexicon::split(std::vector<std::uint32_t> former_neighbours) -> void {
+	auto const count = former_neighbours.size();
+	if (count < 2) {
+		return;
+	}
+	reached_.reset(words_.size());
+	if (owners_.size() < words_.size()) {
+		owners_.resize(words_.size());
+	}
+	if (frontiers_.size() < count) {
+		frontiers_.resize(count);
+	}
+	// for each search, its group (a union-find over searches), the searches of the group it leads,
+	// and how far along its frontier it has expanded
+	auto groups = std::vector<std::uint32_t>(count);
+	auto group_searches = std::vector<std::vector<std::uint32_t>>(count);
+	auto expanded = std::vector<std::size_t>(count, 0);
+	for (auto search = std::uint32_t{0}; search < count; ++search) {
+		groups[search] = search;
+		group_searches[search].assign(1, search);
+		frontiers_[search].assign(1, former_neighbours[search]);
+		reached_.set(former_neighbours[search]);
+		owners_[former_neighbours[search]] = search;
+	}
+	auto const group_of = [&](std::uint32_t search) {
+		while (groups[search] != search) {
+			groups[search] = groups[groups[search]];
+			search = groups[search];
+		}
+		return search;
+	};
+
+	auto live = count;
+	while (live > 1) {
+		for (auto group = std::uint32_t{0}; group < count and live > 1; ++group) {
+			if (groups[group] != group or group_searches[group].empty()) {
+				continue;
+			}
+			auto& searches = group_searches[group];
+			auto const unfinished = std::ranges::find_if(searches, [&](std::uint32_t member) {
+				return expanded[member] < frontiers_[member].size();
+			});
+			if (unfinished == searches.end()) {
+				auto const label = new_label();
+				for (auto const member : searches) {
+					for (auto const word : frontiers_[member]) {
+						leave(word);
+						join(word, label);
+					}
+				}
+				searches.clear();
+				--live;
+				continue;
+			}
+			auto const search = *unfinished;
+			auto& frontier = frontiers_[search];
+			auto const word = frontier[expanded[search]++];
+			for (auto const next : adjacency_[word]) {
+				if (reached_.set(next)) {
+					owners_[next] = search;
+					frontier.push_back(next);
+				}
+				else if (auto const other = group_of(owners_[next]); other != group) {
+					groups[other] = group;
+					searches.insert(searches.end(), group_searches[other].begin(), group_searches[other].end());
+					group_searches[other].clear();
+					--live;
+				}
+			}
+		}
+	}
+}
+
+auto word_ladder::indexed_lexicon::contains(const std::string& word) const -> bool {
+	return ids_.contains(word);
+}
+
+auto word_ladder::indexed_lexicon::size() const -> std::size_t {
+	return ids_.size();
+}
+
+auto word_ladder::indexed_lexicon::neighbours(const std::string& word) const -> std::vector<std::string> {
+	auto adjacent_words = std::vector<std::string>{};
+	auto const found = ids_.find(word);
+	if (found != ids_.end()) {
+		for (auto const neighbour : adjacency_[found->second]) {
+			adjacent_words.push_back(words_[neighbour]);
+		}
+		std::sort(adjacent_words.begin(), adjacent_words.end());
+	}
+	return adjacent_words;
+}
+
+auto word_ladder::indexed_lexicon::connected(const std::string& word1, const std::string& word2) const -> bool {
+	auto const found1 = ids_.find(word1);
+	auto const found2 = ids_.find(word2);
+	return found1 != ids_.end() and found2 != ids_.end() and labels_[found1->second] == labels_[found2->second];
+}
+
+auto word_ladder::indexed_lexicon::component_count() const -> std::size_t {
+	return members_.size() - free_labels_.size();
+}
+
+/**
+ * @brief function to generate the list of all shortest word ladders over the maintained adjacency
+ * lists, with the shared two-phase search. Word ids are not in alphabetical order, so the walk sorts
+ * the neighbours of each word it passes through by word, once
+ *
+ * @param from - the source word
+ * @param to - the target word
+ * @param lexicon - the supporting dictionary used to generate the ladder solution(s)
+ * @return std::vector<std::vector<std::string>> - the list of solutions, in alphabetical order
+ */
+auto word_ladder::generate(const std::string& from, const std::string& to, const indexed_lexicon& lexicon)
+    -> std::vector<std::vector<std::string>> {
+	auto paths = std::vector<std::vector<std::string>>{};
+	if (not lexicon.connected(from, to)) {
+		return paths;
+	}
+	auto const source = lexicon.ids_.at(from);
+	auto const target = lexicon.ids_.at(to);
+	auto budget = detail::unlimited_budget{};
+
+	auto distances = std::vector<std::uint32_t>(lexicon.words_.size(), detail::unreached);
+	detail::label_distances(
+	    target,
+	    source,
+	    0,
+	    distances,
+	    [&](std::uint32_t id) -> const std::vector<std::uint32_t>& { return lexicon.adjacency_[id]; },
+	    budget);
+
+	auto sorted = std::unordered_map<std::uint32_t, std::vector<std::uint32_t>>{};
+	auto const neighbours = [&](std::uint32_t id) -> const std::vector<std::uint32_t>& {
+		auto [found, inserted] = sorted.try_emplace(id, lexicon.adjacency_[id]);
+		if (inserted) {
+			std::sort(found->second.begin(), found->second.end(), [&](std::uint32_t a, std::uint32_t b) {
+				return lexicon.words_[a] < lexicon.words_[b];
+			});
+		}
+		return found->second;
+	};
+	auto path = std::vector<std::uint32_t>{source};
+	detail::walk_closer(
+	    path,
+	    target,
+	    neighbours,
+	    [&](std::uint32_t id) { return distances[id]; },
+	    [&](const std::vector<std::uint32_t>& ladder) {
+		    auto& words = paths.emplace_back();
+		    for (auto const id : ladder) {
+			    words.push_back(lexicon.words_[id]);
+		    }
+		    return true;
+	    },
+	    budget);
+	return paths;
+}
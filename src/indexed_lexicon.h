@@ -0,0 +1,77 @@
+#ifndef COMP6771_INDEXED_LEXICON_H
+#define COMP6771_INDEXED_LEXICON_H
+
+#include "visited_bitmap.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// A lexicon that keeps its neighbour index up to date as words come and go, instead of being
+	// rebuilt. Words are grouped into wildcard buckets, one per word and position with that letter
+	// blanked out ("c*t" holds cat, cot and cut), so the words adjacent to a new word are exactly the
+	// other members of its buckets. Each word keeps its adjacency list and a connected component label.
+	// Adding a word merges the components of its neighbours, relabelling the smaller ones; removing a
+	// word searches outward from all its former neighbours at once only until they meet again, and
+	// relabels only the smaller pieces of a component that has actually split.
+	class indexed_lexicon {
+	public:
+		indexed_lexicon() = default;
+		explicit indexed_lexicon(const std::unordered_set<std::string>& lexicon);
+
+		// Returns true if the word was not already in the lexicon.
+		auto add_word(const std::string& word) -> bool;
+		// Returns true if the word was in the lexicon.
+		auto remove_word(const std::string& word) -> bool;
+
+		auto contains(const std::string& word) const -> bool;
+		auto size() const -> std::size_t;
+		// The words one letter different from word, in alphabetical order.
+		auto neighbours(const std::string& word) const -> std::vector<std::string>;
+		// Whether there is a ladder between two words of the lexicon.
+		auto connected(const std::string& word1, const std::string& word2) const -> bool;
+		auto component_count() const -> std::size_t;
+
+	private:
+		friend auto generate(const std::string& from, const std::string& to, const indexed_lexicon& lexicon)
+		    -> std::vector<std::vector<std::string>>;
+
+		auto new_label() -> std::uint32_t;
+		auto join(std::uint32_t member, std::uint32_t label) -> void;
+		auto leave(std::uint32_t member) -> void;
+		auto merge(std::uint32_t label1, std::uint32_t label2) -> void;
+		// Relabels the parts of a component that removing a word disconnected from each other.
+		auto split(std::vector<std::uint32_t> former_neighbours) -> void;
+
+		// indexed by word id; the word of a free id is empty
+		std::vector<std::string> words_;
+		std::vector<std::vector<std::uint32_t>> adjacency_;
+		std::vector<std::uint32_t> labels_;
+		std::vector<std::uint32_t> member_positions_; // where each word is in the members of its label
+		std::vector<std::uint32_t> free_ids_;
+
+		std::unordered_map<std::string, std::uint32_t> ids_;
+		std::unordered_map<std::string, std::vector<std::uint32_t>> buckets_;
+
+		// indexed by label; the members of a free label are empty
+		std::vector<std::vector<std::uint32_t>> members_;
+		std::vector<std::uint32_t> free_labels_;
+
+		// scratch for split, indexed by word id and by search
+		visited_bitmap reached_;
+		std::vector<std::uint32_t> owners_;
+		std::vector<std::vector<std::uint32_t>> frontiers_;
+	};
+
+	// Same as the lexicon overload of generate, searching the maintained adjacency lists. Returns no
+	// ladders straight away if the words are in different components.
+	// Preconditions: as for generate.
+	auto generate(const std::string& from, const std::string& to, const indexed_lexicon& lexicon)
+	    -> std::vector<std::vector<std::string>>;
+} // namespace word_ladder
+
+#endif // COMP6771_INDEXED_LEXICON_H
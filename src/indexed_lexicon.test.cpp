@@ -0,0 +1,115 @@
+#include "indexed_lexicon.h"
+#include "lexicon_graph.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <vector>
+
+TEST_CASE("adding words links them to their neighbours and merges components") {
+	auto lexicon = ::word_ladder::indexed_lexicon({"cat", "dog", "at"});
+	CHECK(lexicon.size() == 3);
+	CHECK(lexicon.component_count() == 3);
+	CHECK_FALSE(lexicon.connected("cat", "dog"));
+
+	CHECK(lexicon.add_word("cot"));
+	CHECK_FALSE(lexicon.add_word("cot"));
+	CHECK(lexicon.add_word("cut"));
+	CHECK(lexicon.neighbours("cot") == std::vector<std::string>{"cat", "cut"});
+	CHECK(lexicon.component_count() == 3);
+	CHECK(lexicon.connected("cat", "cut"));
+	CHECK_FALSE(lexicon.connected("cat", "dog"));
+
+	// one word joins the two components
+	CHECK(lexicon.add_word("dot"));
+	CHECK(lexicon.component_count() == 2);
+	CHECK(lexicon.connected("cat", "dog"));
+	CHECK(lexicon.neighbours("dot") == std::vector<std::string>{"cot", "dog"});
+	CHECK(::word_ladder::generate("cat", "dog", lexicon)
+	      == std::vector<std::vector<std::string>>{{"cat", "cot", "dot", "dog"}});
+}
+
+TEST_CASE("removing words splits components only when they come apart") {
+	auto lexicon = ::word_ladder::indexed_lexicon({"cat", "cot", "cog", "dog", "dot"});
+	CHECK(lexicon.component_count() == 1);
+
+	// cot -> cog -> dog -> dot -> cot is a cycle, so losing cog keeps everything connected
+	CHECK(lexicon.remove_word("cog"));
+	CHECK_FALSE(lexicon.remove_word("cog"));
+	CHECK_FALSE(lexicon.contains("cog"));
+	CHECK(lexicon.component_count() == 1);
+	CHECK(lexicon.neighbours("dog") == std::vector<std::string>{"dot"});
+	CHECK(::word_ladder::generate("cat", "dog", lexicon)
+	      == std::vector<std::vector<std::string>>{{"cat", "cot", "dot", "dog"}});
+
+	// now cot is a cut word: cat on one side, dot and dog on the other
+	CHECK(lexicon.remove_word("cot"));
+	CHECK(lexicon.component_count() == 2);
+	CHECK_FALSE(lexicon.connected("cat", "dog"));
+	CHECK(lexicon.connected("dot", "dog"));
+	CHECK(::word_ladder::generate("cat", "dog", lexicon).empty());
+
+	// ids and labels freed by removals are reused
+	CHECK(lexicon.add_word("cot"));
+	CHECK(lexicon.component_count() == 1);
+	CHECK(lexicon.size() == 4);
+}
+
+TEST_CASE("removing a word can split its component into several pieces") {
+	// cot is the only link between cat, cog and dot
+	auto lexicon = ::word_ladder::indexed_lexicon({"cat", "cot", "cog", "dot", "dog", "bat"});
+	CHECK(lexicon.component_count() == 1);
+	CHECK(lexicon.remove_word("dog"));
+	CHECK(lexicon.component_count() == 1);
+	CHECK(lexicon.remove_word("cot"));
+	CHECK(lexicon.component_count() == 3);
+	CHECK(lexicon.connected("cat", "bat"));
+	CHECK_FALSE(lexicon.connected("cat", "cog"));
+	CHECK_FALSE(lexicon.connected("cat", "dot"));
+	CHECK_FALSE(lexicon.connected("cog", "dot"));
+	CHECK(lexicon.add_word("cot"));
+	CHECK(lexicon.component_count() == 1);
+}
+
+TEST_CASE("incremental updates match a rebuild") {
+	auto const english_lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto four_letter_words = std::unordered_set<std::string>{};
+	for (auto const& word : english_lexicon) {
+		if (word.size() == 4) {
+			four_letter_words.insert(word);
+		}
+	}
+	auto lexicon = ::word_ladder::indexed_lexicon(four_letter_words);
+	auto remaining = four_letter_words;
+	auto removed = std::vector<std::string>{};
+	for (auto const& word : four_letter_words) {
+		if (word[0] == 'p' or word[3] == 'y') {
+			removed.push_back(word);
+		}
+	}
+	for (auto const& word : removed) {
+		CHECK(lexicon.remove_word(word));
+		remaining.erase(word);
+	}
+
+	auto const rebuilt = ::word_ladder::indexed_lexicon(remaining);
+	CHECK(lexicon.size() == rebuilt.size());
+	CHECK(lexicon.component_count() == rebuilt.component_count());
+	auto const image = ::word_ladder::build_graph_image(remaining);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto components = std::unordered_map<std::uint32_t, std::uint32_t>{};
+	for (auto const& word : remaining) {
+		CHECK(lexicon.neighbours(word) == rebuilt.neighbours(word));
+		components.try_emplace(graph.component(*graph.find(word)), static_cast<std::uint32_t>(components.size()));
+	}
+	CHECK(lexicon.component_count() == components.size());
+	CHECK(::word_ladder::generate("work", "that", lexicon) == ::word_ladder::generate("work", "that", remaining));
+
+	for (auto const& word : removed) {
+		CHECK(lexicon.add_word(word));
+	}
+	CHECK(lexicon.component_count() == ::word_ladder::indexed_lexicon(four_letter_words).component_count());
+	CHECK(::word_ladder::generate("work", "play", lexicon)
+	      == ::word_ladder::generate("work", "play", four_letter_words));
+}
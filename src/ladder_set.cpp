@@ -0,0 +1,66 @@
+#include "ladder_set.h"
+// data structures
+#include <span>
+#include <string>
+#include <vector>
+
+auto word_ladder::ladder_set::ladder::to_vector() const -> std::vector<std::string> {
+	auto words = std::vector<std::string>{};
+	words.reserve(ids_.size());
+	for (auto const id : ids_) {
+		words.emplace_back(graph_.word(id));
+	}
+	return words;
+}
+
+word_ladder::ladder_set::ladder_set(graph_view graph)
+: graph_(graph) {}
+
+auto word_ladder::ladder_set::graph() const -> graph_view {
+	return graph_;
+}
+
+auto word_ladder::ladder_set::size() const -> std::size_t {
+	return starts_.size() - 1;
+}
+
+auto word_ladder::ladder_set::empty() const -> bool {
+	return size() == 0;
+}
+
+auto word_ladder::ladder_set::operator[](std::size_t index) const -> ladder {
+	auto const ids = std::span<const std::uint32_t>(ids_);
+	return ladder(graph_, ids.subspan(starts_[index], starts_[index + 1] - starts_[index]));
+}
+
+auto word_ladder::ladder_set::begin() const -> iterator {
+	return iterator(this, 0);
+}
+
+auto word_ladder::ladder_set::end() const -> iterator {
+	return iterator(this, size());
+}
+
+auto word_ladder::ladder_set::push_back(std::span<const std::uint32_t> ids) -> void {
+	ids_.insert(ids_.end(), ids.begin(), ids.end());
+	starts_.push_back(ids_.size());
+}
+
+auto word_ladder::ladder_set::clear() -> void {
+	ids_.clear();
+	starts_.assign(1, 0);
+}
+
+/**
+ * @brief copy the ladders out as strings, for callers of the vector-of-vectors interface
+ *
+ * @return std::vector<std::vector<std::string>> - the same ladders, in the same order
+ */
+auto word_ladder::ladder_set::to_vectors() const -> std::vector<std::vector<std::string>> {
+	auto ladders = std::vector<std::vector<std::string>>{};
+	ladders.reserve(size());
+	for (auto const ladder : *this) {
+		ladders.push_back(ladder.to_vector());
+	}
+	return ladders;
+}
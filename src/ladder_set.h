@@ -0,0 +1,144 @@
+#ifndef COMP6771_LADDER_SET_H
+#define COMP6771_LADDER_SET_H
+
+#include "lexicon_graph.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace word_ladder {
+	// The ladders of one query as word ids of a lexicon graph: the ids of every ladder back to back in
+	// one buffer, and where each ladder starts in another. Words are read as string_views into the
+	// graph's character arena, so a result holds two allocations however many ladders it has, and no
+	// strings. A ladder_set is only valid while the graph image it was built from stays mapped.
+	class ladder_set {
+	public:
+		// One ladder, as a range of string_views into the graph.
+		class ladder {
+		public:
+			class iterator {
+			public:
+				using value_type = std::string_view;
+				using difference_type = std::ptrdiff_t;
+
+				iterator() = default;
+				iterator(graph_view graph, const std::uint32_t* id)
+				: graph_(graph)
+				, id_(id) {}
+
+				auto operator*() const -> std::string_view {
+					return graph_.word(*id_);
+				}
+				auto operator++() -> iterator& {
+					++id_;
+					return *this;
+				}
+				auto operator++(int) -> iterator {
+					auto const previous = *this;
+					++id_;
+					return previous;
+				}
+				friend auto operator==(const iterator& a, const iterator& b) -> bool {
+					return a.id_ == b.id_;
+				}
+
+			private:
+				graph_view graph_;
+				const std::uint32_t* id_ = nullptr;
+			};
+
+			ladder(graph_view graph, std::span<const std::uint32_t> ids)
+			: graph_(graph)
+			, ids_(ids) {}
+
+			auto size() const -> std::size_t {
+				return ids_.size();
+			}
+			auto operator[](std::size_t index) const -> std::string_view {
+				return graph_.word(ids_[index]);
+			}
+			auto ids() const -> std::span<const std::uint32_t> {
+				return ids_;
+			}
+			auto begin() const -> iterator {
+				return iterator(graph_, ids_.data());
+			}
+			auto end() const -> iterator {
+				return iterator(graph_, ids_.data() + ids_.size());
+			}
+			auto to_vector() const -> std::vector<std::string>;
+
+		private:
+			graph_view graph_;
+			std::span<const std::uint32_t> ids_;
+		};
+
+		class iterator {
+		public:
+			using value_type = ladder;
+			using difference_type = std::ptrdiff_t;
+
+			iterator() = default;
+			iterator(const ladder_set* set, std::size_t index)
+			: set_(set)
+			, index_(index) {}
+
+			auto operator*() const -> ladder {
+				return (*set_)[index_];
+			}
+			auto operator++() -> iterator& {
+				++index_;
+				return *this;
+			}
+			auto operator++(int) -> iterator {
+				auto const previous = *this;
+				++index_;
+				return previous;
+			}
+			friend auto operator==(const iterator& a, const iterator& b) -> bool {
+				return a.index_ == b.index_;
+			}
+
+		private:
+			const ladder_set* set_ = nullptr;
+			std::size_t index_ = 0;
+		};
+
+		ladder_set() = default;
+		explicit ladder_set(graph_view graph);
+
+		auto graph() const -> graph_view;
+		auto size() const -> std::size_t;
+		auto empty() const -> bool;
+		auto operator[](std::size_t index) const -> ladder;
+		auto begin() const -> iterator;
+		auto end() const -> iterator;
+
+		// Appends a ladder given by the ids of its words.
+		auto push_back(std::span<const std::uint32_t> ids) -> void;
+		auto clear() -> void;
+		// Copies the ladders out into the type generate returns.
+		auto to_vectors() const -> std::vector<std::vector<std::string>>;
+
+	private:
+		graph_view graph_;
+		std::vector<std::uint32_t> ids_;
+		// ladder i is ids_[starts_[i], starts_[i + 1])
+		std::vector<std::size_t> starts_ = {0};
+	};
+
+	static_assert(std::forward_iterator<ladder_set::iterator>);
+	static_assert(std::forward_iterator<ladder_set::ladder::iterator>);
+
+	// Same result as generate over a graph_view, in alphabetical order, but as a ladder_set of the
+	// graph, so no word is copied.
+	// Preconditions: as for generate.
+	auto generate_ladders(const std::string& from, const std::string& to, const graph_view& graph) -> ladder_set;
+} // namespace word_ladder
+
+#endif // COMP6771_LADDER_SET_H
@@ -0,0 +1,59 @@
+#include "ladder_set.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("ladder set stores ladders as ids and reads them as views into the graph") {
+	auto const lexicon = std::unordered_set<std::string>{"cat", "cot", "cog", "dog", "dot"};
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+
+	auto ladders = ::word_ladder::ladder_set(graph);
+	CHECK(ladders.empty());
+	auto const first = std::vector<std::uint32_t>{*graph.find("cat"), *graph.find("cot"), *graph.find("dot")};
+	auto const second = std::vector<std::uint32_t>{*graph.find("dog")};
+	ladders.push_back(first);
+	ladders.push_back(second);
+
+	REQUIRE(ladders.size() == 2);
+	CHECK(ladders[0].size() == 3);
+	CHECK(ladders[0][1] == "cot");
+	CHECK(ladders[1][0] == "dog");
+	CHECK(std::vector<std::uint32_t>(ladders[0].ids().begin(), ladders[0].ids().end()) == first);
+	// the words are not copied: they point into the graph image
+	CHECK(ladders[0][0].data() == graph.word(*graph.find("cat")).data());
+
+	auto words = std::vector<std::string_view>{};
+	for (auto const ladder : ladders) {
+		for (auto const word : ladder) {
+			words.push_back(word);
+		}
+	}
+	CHECK(words == std::vector<std::string_view>{"cat", "cot", "dot", "dog"});
+	CHECK(ladders.to_vectors() == std::vector<std::vector<std::string>>{{"cat", "cot", "dot"}, {"dog"}});
+
+	ladders.clear();
+	CHECK(ladders.empty());
+	CHECK(ladders.to_vectors().empty());
+}
+
+TEST_CASE("generate_ladders matches generate") {
+	auto const english_lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(english_lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+
+	for (auto const& [from, to] : std::vector<std::pair<std::string, std::string>>{{"work", "play"},
+	                                                                               {"code", "data"},
+	                                                                               {"awake", "sleep"},
+	                                                                               {"cat", "cat"},
+	                                                                               {"airplane", "tricycle"}}) {
+		auto const ladders = ::word_ladder::generate_ladders(from, to, graph);
+		CHECK(ladders.to_vectors() == ::word_ladder::generate(from, to, english_lexicon));
+	}
+	// words of different lengths have no ladder between them
+	CHECK(::word_ladder::generate_ladders("cat", "dogs", graph).empty());
+}
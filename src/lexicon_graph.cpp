@@ -0,0 +1,871 @@
+#include "lexicon_graph.h"
+#include "ladder_set.h"
+#include "neighbour_provider.h"
+#include "parallel_for.h"
+#include "visited_bitmap.h"
+// data structures
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+// file writing and shared memory
+#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+// other functionality
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <system_error>
+
+namespace {
+	constexpr auto graph_magic = std::uint64_t{0x48504152'47444c57}; // "WLDGRAPH"
+	constexpr auto graph_version = std::uint32_t{2};
+	// landmark distances are stored in a byte; this marks one too long to store
+	constexpr auto far_from_landmark = std::uint8_t{0xff};
+
+	auto align_up(std::uint64_t offset) -> std::uint64_t {
+		return (offset + 7) & ~std::uint64_t{7};
+	}
+
+	/**
+	 * @brief everything needed to lay out a graph image, gathered before any of it is written so the
+	 * image size is known up front and the image can be written straight into its final home
+	 */
+	struct graph_plan {
+		std::vector<std::string_view> words;
+		std::vector<std::uint32_t> first_of_length;
+		std::vector<std::vector<std::uint32_t>> adjacency;
+		std::vector<std::uint32_t> components;
+		word_ladder::graph_header header = {};
+	};
+
+	/**
+	 * @brief labels every word of one length with its connected component, numbering the components in
+	 * order of their smallest id from 0. Words of different lengths are never adjacent, so each length
+	 * can be labelled on its own
+	 *
+	 * @param adjacency - the neighbours of every word
+	 * @param first - the first id of the word length
+	 * @param last - one past the last id of the word length
+	 * @param components - where the component of every word in [first, last) is written
+	 * @return std::uint32_t - the number of components of the length
+	 */
+	auto label_components(const std::vector<std::vector<std::uint32_t>>& adjacency,
+	                      std::uint32_t first,
+	                      std::uint32_t last,
+	                      std::vector<std::uint32_t>& components) -> std::uint32_t {
+		auto const unlabelled = std::numeric_limits<std::uint32_t>::max();
+		std::fill(components.begin() + first, components.begin() + last, unlabelled);
+		auto next_component = std::uint32_t{0};
+		auto stack = std::vector<std::uint32_t>{};
+		for (auto start = first; start < last; ++start) {
+			if (components[start] != unlabelled) {
+				continue;
+			}
+			components[start] = next_component;
+			stack.push_back(start);
+			while (not stack.empty()) {
+				auto const id = stack.back();
+				stack.pop_back();
+				for (auto const neighbour : adjacency[id]) {
+					if (components[neighbour] == unlabelled) {
+						components[neighbour] = next_component;
+						stack.push_back(neighbour);
+					}
+				}
+			}
+			++next_component;
+		}
+		return next_component;
+	}
+
+	/**
+	 * @brief the words of one length ordered by the word with one position removed, which puts each
+	 * wildcard group, the words that differ only at that position, in a run of its own
+	 */
+	struct wildcard_order {
+		std::vector<std::uint32_t> ids;
+		// for each word, by id less the first id of the length, where its run in ids begins and ends
+		std::vector<std::uint32_t> group_begin;
+		std::vector<std::uint32_t> group_end;
+	};
+
+	/**
+	 * @brief sorts the ids in [first, last) by the word with position removed and marks out the runs
+	 *
+	 * @param words - the sorted words
+	 * @param first - the first id of the word length
+	 * @param last - one past the last id of the word length
+	 * @param position - the position the words of a run may differ at
+	 * @return wildcard_order - the ids in order and the run of each
+	 */
+	auto order_by_wildcard(const std::vector<std::string_view>& words,
+	                       std::uint32_t first,
+	                       std::uint32_t last,
+	                       std::size_t position) -> wildcard_order {
+		auto const count = std::size_t{last - first};
+		auto order = wildcard_order{std::vector<std::uint32_t>(count),
+		                            std::vector<std::uint32_t>(count),
+		                            std::vector<std::uint32_t>(count)};
+		for (auto i = std::size_t{0}; i < order.ids.size(); ++i) {
+			order.ids[i] = first + static_cast<std::uint32_t>(i);
+		}
+		auto const compare = [&](std::uint32_t a, std::uint32_t b) {
+			auto const x = words[a];
+			auto const y = words[b];
+			auto const head = x.substr(0, position).compare(y.substr(0, position));
+			return head != 0 ? head : x.substr(position + 1).compare(y.substr(position + 1));
+		};
+		std::sort(order.ids.begin(), order.ids.end(), [&](std::uint32_t a, std::uint32_t b) {
+			return compare(a, b) < 0;
+		});
+
+		auto group_start = std::uint32_t{0};
+		for (auto i = std::uint32_t{1}; i <= order.ids.size(); ++i) {
+			if (i < order.ids.size() and compare(order.ids[group_start], order.ids[i]) == 0) {
+				continue;
+			}
+			for (auto member = group_start; member < i; ++member) {
+				order.group_begin[order.ids[member] - first] = group_start;
+				order.group_end[order.ids[member] - first] = i;
+			}
+			group_start = i;
+		}
+		return order;
+	}
+
+	// ids linked per task, so that the longest lengths are split into many tasks
+	constexpr auto ids_per_task = std::uint32_t{4096};
+
+	/**
+	 * @brief builds the adjacency lists of sorted words and works out where each section of the image
+	 * goes. Words of different lengths are never adjacent, so the work splits into three rounds of
+	 * tasks: one sort per length and position putting the wildcard groups in runs, then the adjacency
+	 * lists of one range of ids at a time gathered from the runs, then the components of one length at
+	 * a time. The 7 to 9 letter lengths hold most of the words, so neither of the first two rounds has
+	 * a task per length only. Every task writes only its own entries, and the component numbers are
+	 * offset by the lengths before, so the plan is the same for any thread count
+	 *
+	 * @param words - the words, sorted by length and then alphabetically, without duplicates
+	 * @param thread_count - the most threads to spread the tasks over
+	 * @return graph_plan - the plan, with a header whose offsets describe the final image
+	 */
+	auto plan_graph(std::vector<std::string_view> words, std::size_t thread_count) -> graph_plan {
+		auto plan = graph_plan{};
+		plan.words = std::move(words);
+
+		auto const max_length = plan.words.empty() ? std::size_t{0} : plan.words.back().size();
+		plan.first_of_length.assign(max_length + 2, 0);
+		auto id = std::size_t{0};
+		for (auto length = std::size_t{0}; length <= max_length + 1; ++length) {
+			while (id < plan.words.size() and plan.words[id].size() < length) {
+				++id;
+			}
+			plan.first_of_length[length] = static_cast<std::uint32_t>(id);
+		}
+
+		plan.adjacency.resize(plan.words.size());
+		plan.components.resize(plan.words.size());
+		auto lengths = std::vector<std::size_t>(max_length + 1);
+		for (auto length = std::size_t{0}; length <= max_length; ++length) {
+			lengths[length] = length;
+		}
+		auto const word_count_of = [&](std::size_t length) {
+			return plan.first_of_length[length + 1] - plan.first_of_length[length];
+		};
+		// the biggest tasks are handed out first
+		std::stable_sort(lengths.begin(), lengths.end(), [&](std::size_t a, std::size_t b) {
+			return word_count_of(a) > word_count_of(b);
+		});
+
+		auto orders = std::vector<std::vector<wildcard_order>>(max_length + 1);
+		auto sorts = std::vector<std::pair<std::size_t, std::size_t>>{};
+		auto id_ranges = std::vector<std::pair<std::uint32_t, std::uint32_t>>{};
+		for (auto const length : lengths) {
+			orders[length].resize(length);
+			for (auto position = std::size_t{0}; position < length; ++position) {
+				sorts.emplace_back(length, position);
+			}
+			for (auto first = plan.first_of_length[length]; first < plan.first_of_length[length + 1];
+			     first += ids_per_task) {
+				id_ranges.emplace_back(first, std::min(first + ids_per_task, plan.first_of_length[length + 1]));
+			}
+		}
+		word_ladder::parallel_for(sorts.size(), thread_count, [&](std::size_t task) {
+			auto const [length, position] = sorts[task];
+			orders[length][position] =
+			    order_by_wildcard(plan.words, plan.first_of_length[length], plan.first_of_length[length + 1], position);
+		});
+		word_ladder::parallel_for(id_ranges.size(), thread_count, [&](std::size_t task) {
+			auto const [begin, end] = id_ranges[task];
+			auto const length = plan.words[begin].size();
+			auto const first = plan.first_of_length[length];
+			for (auto id = begin; id < end; ++id) {
+				auto& neighbours = plan.adjacency[id];
+				for (auto const& order : orders[length]) {
+					for (auto i = order.group_begin[id - first]; i < order.group_end[id - first]; ++i) {
+						if (order.ids[i] != id) {
+							neighbours.push_back(order.ids[i]);
+						}
+					}
+				}
+				std::sort(neighbours.begin(), neighbours.end());
+			}
+		});
+		orders.clear();
+
+		auto component_counts = std::vector<std::uint32_t>(max_length + 1, 0);
+		word_ladder::parallel_for(lengths.size(), thread_count, [&](std::size_t task) {
+			auto const length = lengths[task];
+			auto const first = plan.first_of_length[length];
+			auto const last = plan.first_of_length[length + 1];
+			component_counts[length] = label_components(plan.adjacency, first, last, plan.components);
+		});
+		auto component_offset = std::uint32_t{0};
+		for (auto length = std::size_t{0}; length <= max_length; ++length) {
+			for (auto id = plan.first_of_length[length]; id < plan.first_of_length[length + 1]; ++id) {
+				plan.components[id] += component_offset;
+			}
+			component_offset += component_counts[length];
+		}
+		auto edge_count = std::size_t{0};
+		auto char_count = std::size_t{0};
+		for (auto i = std::size_t{0}; i < plan.words.size(); ++i) {
+			edge_count += plan.adjacency[i].size();
+			char_count += plan.words[i].size();
+		}
+
+		auto& header = plan.header;
+		header.magic = graph_magic;
+		header.version = graph_version;
+		header.word_count = static_cast<std::uint32_t>(plan.words.size());
+		header.max_length = static_cast<std::uint32_t>(max_length);
+		header.edge_count = static_cast<std::uint32_t>(edge_count);
+		header.length_offset = align_up(sizeof(word_ladder::graph_header));
+		header.word_offset = align_up(header.length_offset + (max_length + 2) * sizeof(std::uint32_t));
+		header.char_offset = align_up(header.word_offset + (plan.words.size() + 1) * sizeof(std::uint32_t));
+		header.adjacency_offset = align_up(header.char_offset + char_count);
+		header.neighbour_offset =
+		    align_up(header.adjacency_offset + (plan.words.size() + 1) * sizeof(std::uint32_t));
+		header.component_offset = align_up(header.neighbour_offset + edge_count * sizeof(std::uint32_t));
+		header.landmark_offset = align_up(header.component_offset + plan.words.size() * sizeof(std::uint32_t));
+		header.landmark_count = 0;
+		header.total_size = header.landmark_offset;
+		return plan;
+	}
+
+	/**
+	 * @brief sorts a lexicon and plans its graph
+	 *
+	 * @param lexicon - the dictionary to build the graph of
+	 * @param thread_count - the most threads to spread the lengths over
+	 * @return graph_plan - the plan, with a header whose offsets describe the final image
+	 */
+	auto plan_graph(const std::unordered_set<std::string>& lexicon, std::size_t thread_count) -> graph_plan {
+		auto words = std::vector<std::string_view>(lexicon.begin(), lexicon.end());
+		std::sort(words.begin(), words.end(), [](std::string_view a, std::string_view b) {
+			return a.size() != b.size() ? a.size() < b.size() : a < b;
+		});
+		return plan_graph(std::move(words), thread_count);
+	}
+
+	/**
+	 * @brief writes the image described by a plan. The header goes last, so a reader that maps the
+	 * image while it is still being written sees no magic number rather than half a graph
+	 *
+	 * @param plan - the plan from plan_graph
+	 * @param out - zero-filled storage of at least plan.header.total_size bytes
+	 */
+	auto write_graph(const graph_plan& plan, std::byte* out) -> void {
+		auto const& header = plan.header;
+		auto const store = [out](std::uint64_t offset, std::uint32_t value) {
+			std::memcpy(out + offset, &value, sizeof(value));
+		};
+		for (auto i = std::size_t{0}; i < plan.first_of_length.size(); ++i) {
+			store(header.length_offset + i * sizeof(std::uint32_t), plan.first_of_length[i]);
+		}
+		auto char_position = std::uint32_t{0};
+		auto edge_position = std::uint32_t{0};
+		for (auto i = std::size_t{0}; i < plan.words.size(); ++i) {
+			store(header.word_offset + i * sizeof(std::uint32_t), char_position);
+			std::memcpy(out + header.char_offset + char_position, plan.words[i].data(), plan.words[i].size());
+			char_position += static_cast<std::uint32_t>(plan.words[i].size());
+
+			store(header.adjacency_offset + i * sizeof(std::uint32_t), edge_position);
+			std::memcpy(out + header.neighbour_offset + edge_position * sizeof(std::uint32_t),
+			            plan.adjacency[i].data(),
+			            plan.adjacency[i].size() * sizeof(std::uint32_t));
+			edge_position += static_cast<std::uint32_t>(plan.adjacency[i].size());
+			store(header.component_offset + i * sizeof(std::uint32_t), plan.components[i]);
+		}
+		store(header.word_offset + plan.words.size() * sizeof(std::uint32_t), char_position);
+		store(header.adjacency_offset + plan.words.size() * sizeof(std::uint32_t), edge_position);
+
+		std::atomic_thread_fence(std::memory_order_release);
+		std::memcpy(out, &header, sizeof(header));
+	}
+
+	/**
+	 * @brief breadth-first distances from one word to the rest of its component
+	 *
+	 * @param graph - the graph to search
+	 * @param source - the word to measure from
+	 * @param distances - indexed by id; must be unreachable_distance for the whole component on entry
+	 * @return std::vector<std::uint32_t> - the ids whose distances were set, which is the component
+	 */
+	auto breadth_first(const word_ladder::graph_view& graph,
+	                   std::uint32_t source,
+	                   std::vector<std::uint32_t>& distances) -> std::vector<std::uint32_t> {
+		auto reached = std::vector<std::uint32_t>{source};
+		distances[source] = 0;
+		for (auto i = std::size_t{0}; i < reached.size(); ++i) {
+			auto const id = reached[i];
+			for (auto const neighbour : graph.neighbours(id)) {
+				if (distances[neighbour] == word_ladder::unreachable_distance) {
+					distances[neighbour] = distances[id] + 1;
+					reached.push_back(neighbour);
+				}
+			}
+		}
+		return reached;
+	}
+
+	/**
+	 * @brief helper function to count the letters two words of the same length differ in, which is a
+	 * lower bound on the rungs between them
+	 *
+	 * @param word1 - the first word
+	 * @param word2 - the second word
+	 * @return std::uint32_t - the number of positions the words differ at
+	 */
+	auto hamming_distance(std::string_view word1, std::string_view word2) -> std::uint32_t {
+		auto distance = std::uint32_t{0};
+		for (auto i = std::size_t{0}; i < word1.size(); ++i) {
+			if (word1[i] != word2[i]) {
+				++distance;
+			}
+		}
+		return distance;
+	}
+
+	/**
+	 * @brief wraps a failed system call in an exception
+	 */
+	[[noreturn]] auto throw_errno(const std::string& what) -> void {
+		throw std::system_error(errno, std::generic_category(), what);
+	}
+} // namespace
+
+word_ladder::graph_view::graph_view(const std::byte* base)
+: base_(base) {
+	auto header = graph_header{};
+	std::memcpy(&header, base, sizeof(header));
+	if (header.magic != graph_magic or header.version != graph_version) {
+		throw std::runtime_error("word_ladder: not a lexicon graph image");
+	}
+}
+
+template<typename T>
+auto word_ladder::graph_view::section(std::uint64_t offset) const -> const T* {
+	return reinterpret_cast<const T*>(base_ + offset);
+}
+
+auto word_ladder::graph_view::word_count() const -> std::uint32_t {
+	return section<graph_header>(0)->word_count;
+}
+
+auto word_ladder::graph_view::max_length() const -> std::uint32_t {
+	return section<graph_header>(0)->max_length;
+}
+
+auto word_ladder::graph_view::size_bytes() const -> std::size_t {
+	return static_cast<std::size_t>(section<graph_header>(0)->total_size);
+}
+
+auto word_ladder::graph_view::data() const -> const std::byte* {
+	return base_;
+}
+
+auto word_ladder::graph_view::word(std::uint32_t id) const -> std::string_view {
+	auto const* header = section<graph_header>(0);
+	auto const* offsets = section<std::uint32_t>(header->word_offset);
+	return std::string_view(section<char>(header->char_offset) + offsets[id], offsets[id + 1] - offsets[id]);
+}
+
+/**
+ * @brief binary searches the ids of the word's length, which are in alphabetical order
+ *
+ * @param word - the word to look up
+ * @return std::optional<std::uint32_t> - the id of the word, or nothing if it is not in the lexicon
+ */
+auto word_ladder::graph_view::find(std::string_view word) const -> std::optional<std::uint32_t> {
+	auto const last = ids_of_length(word.size()).second;
+	auto low = ids_of_length(word.size()).first;
+	auto high = last;
+	while (low < high) {
+		auto const middle = low + (high - low) / 2;
+		if (this->word(middle) < word) {
+			low = middle + 1;
+		}
+		else {
+			high = middle;
+		}
+	}
+	if (low < last and this->word(low) == word) {
+		return low;
+	}
+	return std::nullopt;
+}
+
+auto word_ladder::graph_view::neighbours(std::uint32_t id) const -> std::span<const std::uint32_t> {
+	auto const* header = section<graph_header>(0);
+	auto const* offsets = section<std::uint32_t>(header->adjacency_offset);
+	return std::span<const std::uint32_t>(section<std::uint32_t>(header->neighbour_offset) + offsets[id],
+	                                      offsets[id + 1] - offsets[id]);
+}
+
+auto word_ladder::graph_view::ids_of_length(std::size_t length) const -> std::pair<std::uint32_t, std::uint32_t> {
+	auto const* header = section<graph_header>(0);
+	if (length > header->max_length) {
+		return {header->word_count, header->word_count};
+	}
+	auto const* first = section<std::uint32_t>(header->length_offset);
+	return {first[length], first[length + 1]};
+}
+
+auto word_ladder::graph_view::component(std::uint32_t id) const -> std::uint32_t {
+	return section<std::uint32_t>(section<graph_header>(0)->component_offset)[id];
+}
+
+auto word_ladder::graph_view::landmark_count() const -> std::uint32_t {
+	return section<graph_header>(0)->landmark_count;
+}
+
+auto word_ladder::graph_view::landmark_distances(std::uint32_t id) const -> std::span<const std::uint8_t> {
+	auto const* header = section<graph_header>(0);
+	return std::span<const std::uint8_t>(section<std::uint8_t>(header->landmark_offset) + id * header->landmark_count,
+	                                     header->landmark_count);
+}
+
+/**
+ * @brief bound the rungs between two words with the triangle inequality: for any landmark l,
+ * d(from, to) >= |d(l, from) - d(l, to)|. Distances too long to store are skipped, as they would not
+ * give a safe bound
+ *
+ * @param from - the first word
+ * @param to - the second word, of the same length
+ * @return std::uint32_t - the largest bound over all landmarks, or unreachable_distance if no ladder exists
+ */
+auto word_ladder::graph_view::lower_bound(std::uint32_t from, std::uint32_t to) const -> std::uint32_t {
+	if (component(from) != component(to)) {
+		return unreachable_distance;
+	}
+	auto const from_distances = landmark_distances(from);
+	auto const to_distances = landmark_distances(to);
+	auto bound = std::uint32_t{0};
+	for (auto k = std::size_t{0}; k < from_distances.size(); ++k) {
+		if (from_distances[k] == far_from_landmark or to_distances[k] == far_from_landmark) {
+			continue;
+		}
+		auto const difference = from_distances[k] > to_distances[k] ? from_distances[k] - to_distances[k]
+		                                                            : to_distances[k] - from_distances[k];
+		bound = std::max(bound, static_cast<std::uint32_t>(difference));
+	}
+	return bound;
+}
+
+/**
+ * @brief build the graph image of a lexicon in ordinary memory, e.g. to save it or to search it
+ * without shared memory
+ *
+ * @param lexicon - the dictionary to build the graph of
+ * @param thread_count - the most threads to build it with
+ * @return std::vector<std::byte> - the image, ready to be wrapped in a graph_view
+ */
+auto word_ladder::build_graph_image(const std::unordered_set<std::string>& lexicon, std::size_t thread_count)
+    -> std::vector<std::byte> {
+	auto const plan = plan_graph(lexicon, thread_count);
+	auto image = std::vector<std::byte>(static_cast<std::size_t>(plan.header.total_size));
+	write_graph(plan, image.data());
+	return image;
+}
+
+/**
+ * @brief build the graph image of words that are already sorted, e.g. by load_graph_image
+ *
+ * @param sorted_words - the words, sorted by length and then alphabetically, without duplicates
+ * @param thread_count - the most threads to build it with
+ * @return std::vector<std::byte> - the image, ready to be wrapped in a graph_view
+ */
+auto word_ladder::build_graph_image(std::span<const std::string_view> sorted_words, std::size_t thread_count)
+    -> std::vector<std::byte> {
+	auto const plan = plan_graph(std::vector<std::string_view>(sorted_words.begin(), sorted_words.end()), thread_count);
+	auto image = std::vector<std::byte>(static_cast<std::size_t>(plan.header.total_size));
+	write_graph(plan, image.data());
+	return image;
+}
+
+/**
+ * @brief add a landmark table to a graph image. The landmarks of each component are picked by
+ * farthest-point selection: the first is the word farthest from the component's first word, and each
+ * later one is the word farthest from all landmarks picked so far, which spreads them to the edges of
+ * the component where they give the tightest bounds
+ *
+ * @param graph - the image to copy; any landmark table it already has is replaced
+ * @param landmarks_per_component - how many landmarks to pick in every component
+ * @return std::vector<std::byte> - the new image
+ */
+auto word_ladder::build_landmarks(const graph_view& graph, std::size_t landmarks_per_component)
+    -> std::vector<std::byte> {
+	auto header = graph_header{};
+	std::memcpy(&header, graph.data(), sizeof(header));
+	auto const landmark_count = static_cast<std::uint32_t>(landmarks_per_component);
+	header.landmark_count = landmark_count;
+	header.total_size = align_up(header.landmark_offset + std::uint64_t{header.word_count} * landmark_count);
+
+	auto image = std::vector<std::byte>(static_cast<std::size_t>(header.total_size));
+	std::memcpy(image.data(), graph.data(), static_cast<std::size_t>(header.landmark_offset));
+	auto* const table = reinterpret_cast<std::uint8_t*>(image.data() + header.landmark_offset);
+
+	auto distances = std::vector<std::uint32_t>(header.word_count, unreachable_distance);
+	auto nearest_landmark = std::vector<std::uint32_t>(header.word_count, unreachable_distance);
+	auto done = std::vector<bool>(header.word_count, false);
+	auto const farthest = [](const std::vector<std::uint32_t>& ids, const std::vector<std::uint32_t>& by) {
+		return *std::max_element(ids.begin(), ids.end(), [&](std::uint32_t a, std::uint32_t b) {
+			return by[a] < by[b];
+		});
+	};
+	for (auto start = std::uint32_t{0}; start < header.word_count; ++start) {
+		if (done[start]) {
+			continue;
+		}
+		auto const component = breadth_first(graph, start, distances);
+		auto landmark = farthest(component, distances);
+		for (auto const id : component) {
+			done[id] = true;
+			distances[id] = unreachable_distance;
+		}
+		for (auto k = std::size_t{0}; k < landmark_count; ++k) {
+			breadth_first(graph, landmark, distances);
+			for (auto const id : component) {
+				table[std::size_t{id} * landmark_count + k] = distances[id] < far_from_landmark
+				                                                  ? static_cast<std::uint8_t>(distances[id])
+				                                                  : far_from_landmark;
+				nearest_landmark[id] = std::min(nearest_landmark[id], distances[id]);
+				distances[id] = unreachable_distance;
+			}
+			landmark = farthest(component, nearest_landmark);
+		}
+	}
+
+	std::memcpy(image.data(), &header, sizeof(header));
+	return image;
+}
+
+/**
+ * @brief save an image so that later runs can map it instead of rebuilding it
+ *
+ * @param graph - the image to save
+ * @param path - the snapshot file to write
+ */
+auto word_ladder::save_graph_image(const graph_view& graph, const std::string& path) -> void {
+	auto file_stream = std::ofstream(path, std::ios::binary | std::ios::trunc);
+	file_stream.write(reinterpret_cast<const char*>(graph.data()), static_cast<std::streamsize>(graph.size_bytes()));
+	file_stream.close();
+	if (not file_stream) {
+		throw std::system_error(errno, std::generic_category(), "write " + path);
+	}
+}
+
+word_ladder::shared_graph::shared_graph(void* address, std::size_t length)
+: address_(address)
+, length_(length) {}
+
+word_ladder::shared_graph::shared_graph(shared_graph&& other) noexcept
+: address_(std::exchange(other.address_, nullptr))
+, length_(std::exchange(other.length_, 0)) {}
+
+auto word_ladder::shared_graph::operator=(shared_graph&& other) noexcept -> shared_graph& {
+	if (this != &other) {
+		if (address_ != nullptr) {
+			::munmap(address_, length_);
+		}
+		address_ = std::exchange(other.address_, nullptr);
+		length_ = std::exchange(other.length_, 0);
+	}
+	return *this;
+}
+
+word_ladder::shared_graph::~shared_graph() {
+	if (address_ != nullptr) {
+		::munmap(address_, length_);
+	}
+}
+
+/**
+ * @brief build the graph of a lexicon straight into a new shared-memory segment, then drop write
+ * access so the creating process sees the same read-only graph as everyone else
+ *
+ * @param name - the segment name, e.g. "/word_ladder_english"
+ * @param lexicon - the dictionary to build the graph of
+ * @return shared_graph - the creator's mapping of the segment
+ */
+auto word_ladder::shared_graph::create(const std::string& name, const std::unordered_set<std::string>& lexicon)
+    -> shared_graph {
+	auto const plan = plan_graph(lexicon, 1);
+	auto const length = static_cast<std::size_t>(plan.header.total_size);
+
+	auto const fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+	if (fd < 0) {
+		throw_errno("shm_open " + name);
+	}
+	if (::ftruncate(fd, static_cast<off_t>(length)) != 0) {
+		auto const error = errno;
+		::close(fd);
+		::shm_unlink(name.c_str());
+		errno = error;
+		throw_errno("ftruncate " + name);
+	}
+	auto* const address = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (address == MAP_FAILED) {
+		auto const error = errno;
+		::shm_unlink(name.c_str());
+		errno = error;
+		throw_errno("mmap " + name);
+	}
+	write_graph(plan, static_cast<std::byte*>(address));
+	if (::mprotect(address, length, PROT_READ) != 0) {
+		auto const error = errno;
+		::munmap(address, length);
+		::shm_unlink(name.c_str());
+		errno = error;
+		throw_errno("mprotect " + name);
+	}
+	return shared_graph(address, length);
+}
+
+/**
+ * @brief map a segment made by create. The mapping is read-only, so every process shares the same
+ * physical pages
+ *
+ * @param name - the segment name given to create
+ * @return shared_graph - this process's mapping of the segment
+ */
+auto word_ladder::shared_graph::open(const std::string& name) -> shared_graph {
+	auto const fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+	if (fd < 0) {
+		throw_errno("shm_open " + name);
+	}
+	return map_read_only(fd, name);
+}
+
+/**
+ * @brief map a snapshot file. As with open, the mapping is read-only and backed by shared pages
+ *
+ * @param path - the file written by save_graph_image
+ * @return shared_graph - this process's mapping of the file
+ */
+auto word_ladder::shared_graph::map_file(const std::string& path) -> shared_graph {
+	auto const fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		throw_errno("open " + path);
+	}
+	return map_read_only(fd, path);
+}
+
+auto word_ladder::shared_graph::map_read_only(int fd, const std::string& what) -> shared_graph {
+	struct stat status = {};
+	if (::fstat(fd, &status) != 0) {
+		auto const error = errno;
+		::close(fd);
+		errno = error;
+		throw_errno("fstat " + what);
+	}
+	auto const length = static_cast<std::size_t>(status.st_size);
+	if (length < sizeof(graph_header)) {
+		::close(fd);
+		throw std::runtime_error("word_ladder: " + what + " is too small to be a lexicon graph image");
+	}
+	auto* const address = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (address == MAP_FAILED) {
+		throw_errno("mmap " + what);
+	}
+	auto graph = shared_graph(address, length);
+	if (graph.view().size_bytes() > length) { // also validates the header
+		throw std::runtime_error("word_ladder: " + what + " is truncated");
+	}
+	return graph;
+}
+
+auto word_ladder::shared_graph::unlink(const std::string& name) -> void {
+	::shm_unlink(name.c_str());
+}
+
+auto word_ladder::shared_graph::view() const -> graph_view {
+	return graph_view(static_cast<const std::byte*>(address_));
+}
+
+/**
+ * @brief generate all shortest word ladders with the shared two-phase search over word ids. The
+ * distances are a stamped_distances array that belongs to the thread; its next query forgets them by
+ * bumping the epoch, so no query clears the array. Adjacency lists are ascending and ids are in
+ * alphabetical order within a length, so the ladders come out in alphabetical order
+ *
+ * @param from - the source word
+ * @param to - the target word
+ * @param graph - the graph of the supporting dictionary
+ * @return ladder_set - the list of solutions as word ids of the graph, in alphabetical order
+ */
+auto word_ladder::generate_ladders(const std::string& from, const std::string& to, const graph_view& graph)
+    -> ladder_set {
+	auto ladders = ladder_set(graph);
+	auto const source = graph.find(from);
+	auto const target = graph.find(to);
+	if (not source or not target or from.size() != to.size()) {
+		return ladders;
+	}
+
+	auto const [first, last] = graph.ids_of_length(from.size());
+	static_assert(stamped_distances::unset == detail::unreached);
+	thread_local auto distances = stamped_distances{};
+	distances.reset(last - first);
+	auto budget = detail::unlimited_budget{};
+	auto const neighbours = [&](std::uint32_t id) { return graph.neighbours(id); };
+	detail::label_distances(*target, *source, first, distances, neighbours, budget);
+	if (distances[*source - first] == detail::unreached) {
+		return ladders;
+	}
+	auto path = std::vector<std::uint32_t>{*source};
+	detail::walk_closer(
+	    path,
+	    *target,
+	    neighbours,
+	    [&](std::uint32_t id) { return distances[id - first]; },
+	    [&](const std::vector<std::uint32_t>& ladder) {
+		    ladders.push_back(ladder);
+		    return true;
+	    },
+	    budget);
+	return ladders;
+}
+
+/**
+ * @brief generate all shortest word ladders over a prebuilt graph, copied out as strings
+ *
+ * @param from - the source word
+ * @param to - the target word
+ * @param graph - the graph of the supporting dictionary
+ * @return std::vector<std::vector<std::string>> - the list of solutions, in alphabetical order
+ */
+auto word_ladder::generate(const std::string& from, const std::string& to, const graph_view& graph)
+    -> std::vector<std::vector<std::string>> {
+	return generate_ladders(from, to, graph).to_vectors();
+}
+
+/**
+ * @brief generate all shortest word ladders with an A* search backward from the target, bounding the
+ * rungs left to the start word by the larger of the hamming distance and the landmark bound. Both
+ * bounds are consistent, so a word's depth is final when it leaves the queue and the estimates never
+ * fall; the queue is a bucket per estimated ladder length, with no heap. The search stops after the
+ * bucket of the shortest ladder, having labelled every word on one, and never labels a word whose
+ * estimate is longer. The shared walk then follows the labels forward from the start word
+ *
+ * @param from - the source word
+ * @param to - the target word
+ * @param graph - the graph of the supporting dictionary, ideally with a landmark table
+ * @return std::vector<std::vector<std::string>> - the list of solutions, in alphabetical order
+ */
+auto word_ladder::generate_landmarks(const std::string& from, const std::string& to, const graph_view& graph)
+    -> std::vector<std::vector<std::string>> {
+	auto paths = std::vector<std::vector<std::string>>{};
+	auto const source = graph.find(from);
+	auto const target = graph.find(to);
+	if (not source or not target or graph.lower_bound(*source, *target) == unreachable_distance) {
+		return paths;
+	}
+
+	auto const [first, last] = graph.ids_of_length(from.size());
+	auto const source_landmarks = graph.landmark_distances(*source);
+	auto const bound_to_source = [&](std::uint32_t id) {
+		auto const landmarks = graph.landmark_distances(id);
+		auto bound = hamming_distance(graph.word(id), from);
+		for (auto k = std::size_t{0}; k < landmarks.size(); ++k) {
+			if (landmarks[k] != far_from_landmark and source_landmarks[k] != far_from_landmark) {
+				auto const difference = landmarks[k] > source_landmarks[k] ? landmarks[k] - source_landmarks[k]
+				                                                           : source_landmarks[k] - landmarks[k];
+				bound = std::max(bound, static_cast<std::uint32_t>(difference));
+			}
+		}
+		return bound;
+	};
+	// bucket k holds the (word, rungs to the target) entries estimated at first_bucket + k rungs in all.
+	// An entry is stale if its word has been reached in fewer rungs since it was queued
+	thread_local auto distances = stamped_distances{};
+	thread_local auto buckets = std::vector<std::vector<std::pair<std::uint32_t, std::uint32_t>>>{};
+	distances.reset(last - first);
+	auto const first_bucket = bound_to_source(*target);
+	auto const queue = [&](std::uint32_t id, std::uint32_t rungs, std::uint32_t bucket) {
+		if (bucket - first_bucket >= buckets.size()) {
+			buckets.resize(bucket - first_bucket + 1);
+		}
+		buckets[bucket - first_bucket].emplace_back(id, rungs);
+	};
+	for (auto& bucket : buckets) {
+		bucket.clear();
+	}
+	distances[*target - first] = 0;
+	queue(*target, 0, first_bucket);
+	auto shortest = unreachable_distance;
+	for (auto length = first_bucket; length - first_bucket < buckets.size() and length <= shortest; ++length) {
+		// indexed afresh each time, as queueing may grow the bucket or reallocate the buckets
+		for (auto i = std::size_t{0}; i < buckets[length - first_bucket].size(); ++i) {
+			auto const [id, rungs] = buckets[length - first_bucket][i];
+			if (rungs != distances[id - first]) {
+				continue;
+			}
+			if (id == *source) {
+				shortest = rungs;
+				continue;
+			}
+			for (auto const next : graph.neighbours(id)) {
+				auto& known = distances[next - first];
+				if (rungs + 1 < known) {
+					auto const estimate = rungs + 1 + bound_to_source(next);
+					if (estimate <= shortest) {
+						known = rungs + 1;
+						queue(next, rungs + 1, estimate);
+					}
+				}
+			}
+		}
+	}
+	if (shortest == unreachable_distance) {
+		return paths;
+	}
+
+	auto budget = detail::unlimited_budget{};
+	auto path = std::vector<std::uint32_t>{*source};
+	detail::walk_closer(
+	    path,
+	    *target,
+	    [&](std::uint32_t id) { return graph.neighbours(id); },
+	    [&](std::uint32_t id) { return distances[id - first]; },
+	    [&](const std::vector<std::uint32_t>& ladder) {
+		    auto& words = paths.emplace_back();
+		    for (auto const id : ladder) {
+			    words.emplace_back(graph.word(id));
+		    }
+		    return true;
+	    },
+	    budget);
+	return paths;
+}
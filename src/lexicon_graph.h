@@ -0,0 +1,139 @@
+#ifndef COMP6771_LEXICON_GRAPH_H
+#define COMP6771_LEXICON_GRAPH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace word_ladder {
+	// Layout of a lexicon graph image. Every section is addressed by a byte offset from the start of
+	// the image rather than by a pointer, so one image can be mapped at a different address in every
+	// process that reads it.
+	struct graph_header {
+		std::uint64_t magic;
+		std::uint32_t version;
+		std::uint32_t word_count;
+		std::uint32_t max_length;
+		std::uint32_t edge_count;
+		std::uint32_t landmark_count; // landmarks per component, 0 if the image has no landmark table
+		std::uint32_t reserved;
+		std::uint64_t total_size;
+		std::uint64_t length_offset; // u32[max_length + 2]: first word id of each word length
+		std::uint64_t word_offset; // u32[word_count + 1]: start of each word in the character arena
+		std::uint64_t char_offset; // char[]: every word, concatenated
+		std::uint64_t adjacency_offset; // u32[word_count + 1]: start of each word's neighbour list
+		std::uint64_t neighbour_offset; // u32[edge_count]: neighbour ids, ascending
+		std::uint64_t component_offset; // u32[word_count]: connected component of each word
+		std::uint64_t landmark_offset; // u8[word_count * landmark_count]: distance from each landmark
+	};
+
+	// Read-only view over a lexicon graph image. Words are numbered in (length, alphabetical) order,
+	// so the ids of one word length are contiguous and ascending ids are alphabetical.
+	class graph_view {
+	public:
+		graph_view() = default;
+		// Throws std::runtime_error if base does not point at a lexicon graph image.
+		explicit graph_view(const std::byte* base);
+
+		auto word_count() const -> std::uint32_t;
+		auto max_length() const -> std::uint32_t;
+		auto size_bytes() const -> std::size_t;
+		auto data() const -> const std::byte*;
+
+		auto word(std::uint32_t id) const -> std::string_view;
+		auto find(std::string_view word) const -> std::optional<std::uint32_t>;
+		auto neighbours(std::uint32_t id) const -> std::span<const std::uint32_t>;
+		// The half-open range of ids whose words have the given length.
+		auto ids_of_length(std::size_t length) const -> std::pair<std::uint32_t, std::uint32_t>;
+		// Words are in the same component if and only if there is a ladder between them.
+		auto component(std::uint32_t id) const -> std::uint32_t;
+
+		auto landmark_count() const -> std::uint32_t;
+		// Entry k is the number of rungs between the word and the k-th landmark of its component.
+		auto landmark_distances(std::uint32_t id) const -> std::span<const std::uint8_t>;
+		// A lower bound on the rungs between two words of the same length, from the landmark table and
+		// the triangle inequality. Returns unreachable_distance if the words are in different components.
+		auto lower_bound(std::uint32_t from, std::uint32_t to) const -> std::uint32_t;
+
+	private:
+		template<typename T>
+		auto section(std::uint64_t offset) const -> const T*;
+
+		const std::byte* base_ = nullptr;
+	};
+
+	inline constexpr auto unreachable_distance = std::uint32_t{0xffffffff};
+
+	// Builds the graph image of a lexicon, where two words are adjacent if they have the same length
+	// and differ in exactly one letter. The work is cut into tasks of one length and letter position
+	// or one range of ids each, spread over up to thread_count threads; the image is the same for any
+	// thread count.
+	auto build_graph_image(const std::unordered_set<std::string>& lexicon, std::size_t thread_count = 1)
+	    -> std::vector<std::byte>;
+	// Same, from words already sorted by length and then alphabetically, without duplicates.
+	auto build_graph_image(std::span<const std::string_view> sorted_words, std::size_t thread_count)
+	    -> std::vector<std::byte>;
+
+	// Copies a graph image and adds a landmark table to it: landmarks_per_component words picked far
+	// apart in every component, and each word's breadth-first distance from them. This is the
+	// expensive, offline half of generate_landmarks; save the result with save_graph_image.
+	auto build_landmarks(const graph_view& graph, std::size_t landmarks_per_component) -> std::vector<std::byte>;
+
+	// Writes an image to a snapshot file, which shared_graph::map_file loads.
+	// Throws std::system_error if the file cannot be written.
+	auto save_graph_image(const graph_view& graph, const std::string& path) -> void;
+
+	// A lexicon graph image held in a POSIX shared-memory segment. One process creates the segment
+	// and every other process maps it read-only, so a host pays for one copy of the graph no matter
+	// how many workers it runs.
+	class shared_graph {
+	public:
+		// Builds the graph of lexicon directly into a new segment called name.
+		// Throws std::system_error if the segment already exists or cannot be created.
+		static auto create(const std::string& name, const std::unordered_set<std::string>& lexicon) -> shared_graph;
+		// Maps the existing segment called name read-only.
+		static auto open(const std::string& name) -> shared_graph;
+		// Removes the segment name. Existing mappings stay valid until they are unmapped.
+		static auto unlink(const std::string& name) -> void;
+		// Maps a snapshot file written by save_graph_image read-only. Processes that map the same file
+		// share its pages through the page cache.
+		static auto map_file(const std::string& path) -> shared_graph;
+
+		shared_graph(shared_graph&& other) noexcept;
+		auto operator=(shared_graph&& other) noexcept -> shared_graph&;
+		shared_graph(const shared_graph&) = delete;
+		auto operator=(const shared_graph&) -> shared_graph& = delete;
+		~shared_graph();
+
+		auto view() const -> graph_view;
+
+	private:
+		shared_graph(void* address, std::size_t length);
+		// Maps all of fd read-only and closes it.
+		static auto map_read_only(int fd, const std::string& what) -> shared_graph;
+
+		void* address_ = nullptr;
+		std::size_t length_ = 0;
+	};
+
+	// Same as the lexicon overload of generate, but searches a prebuilt graph.
+	auto generate(const std::string& from, const std::string& to, const graph_view& graph)
+	    -> std::vector<std::vector<std::string>>;
+
+	// Same result as generate, but found with an A* search that bounds the rest of each ladder with
+	// both the number of differing letters and the graph's landmark table. It is worth using when the
+	// bounds are tight and the ladders few, as it then labels far fewer words: charge -> comedo runs in
+	// about a third of generate's time. When many ladders spread over a wide band of words, as for
+	// atlases -> cabaret, looking up the bounds costs more than it saves and generate is about 15%
+	// faster. Without a landmark table only the differing letters bound the search.
+	auto generate_landmarks(const std::string& from, const std::string& to, const graph_view& graph)
+	    -> std::vector<std::vector<std::string>>;
+} // namespace word_ladder
+
+#endif // COMP6771_LEXICON_GRAPH_H
@@ -0,0 +1,123 @@
+#include "lexicon_graph.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+
+TEST_CASE("graph numbers words by length, then alphabetically") {
+	auto const lexicon = std::unordered_set<std::string>{"cat", "at", "cot", "it", "dog", "cog"};
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+
+	CHECK(graph.word_count() == 6);
+	CHECK(graph.max_length() == 3);
+	CHECK(graph.word(0) == "at");
+	CHECK(graph.word(1) == "it");
+	CHECK(graph.word(2) == "cat");
+	CHECK(graph.word(5) == "dog");
+	CHECK(graph.ids_of_length(3) == std::pair<std::uint32_t, std::uint32_t>{2, 6});
+	CHECK(graph.find("cot") == 4);
+	CHECK(graph.find("cut") == std::nullopt);
+	CHECK(graph.find("house") == std::nullopt);
+}
+
+TEST_CASE("graph neighbours differ by exactly one letter and are in alphabetical order") {
+	auto const lexicon = std::unordered_set<std::string>{"cat", "cot", "cog", "dog", "dot", "cut", "at"};
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+
+	auto neighbours = std::vector<std::string>{};
+	for (auto const id : graph.neighbours(*graph.find("cot"))) {
+		neighbours.emplace_back(graph.word(id));
+	}
+	CHECK(neighbours == std::vector<std::string>{"cat", "cog", "cut", "dot"});
+	CHECK(graph.neighbours(*graph.find("at")).empty());
+}
+
+TEST_CASE("graph generate matches lexicon generate") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+
+	CHECK(::word_ladder::generate("work", "play", graph) == ::word_ladder::generate("work", "play", lexicon));
+	CHECK(::word_ladder::generate("awake", "sleep", graph) == ::word_ladder::generate("awake", "sleep", lexicon));
+	CHECK(::word_ladder::generate("cat", "cut", graph) == std::vector<std::vector<std::string>>{{"cat", "cut"}});
+	CHECK(::word_ladder::generate("airplane", "tricycle", graph).empty());
+	CHECK(::word_ladder::generate("work", "pqrs", graph).empty());
+}
+
+TEST_CASE("shared graph is mapped read-only by later openers") {
+	auto const name = "/word_ladder_test_" + std::to_string(::getpid());
+	auto const lexicon = std::unordered_set<std::string>{"at", "it", "cat", "cot", "cog", "dog"};
+	::word_ladder::shared_graph::unlink(name);
+	auto const created = ::word_ladder::shared_graph::create(name, lexicon);
+	CHECK_THROWS(::word_ladder::shared_graph::create(name, lexicon));
+
+	auto const opened = ::word_ladder::shared_graph::open(name);
+	CHECK(opened.view().data() != created.view().data());
+	CHECK(opened.view().size_bytes() == created.view().size_bytes());
+	auto const expected = std::vector<std::vector<std::string>>{{"cat", "cot", "cog", "dog"}};
+	CHECK(::word_ladder::generate("cat", "dog", opened.view()) == expected);
+
+	::word_ladder::shared_graph::unlink(name);
+	CHECK(::word_ladder::generate("cat", "dog", opened.view()) == expected);
+	CHECK_THROWS(::word_ladder::shared_graph::open(name));
+}
+
+TEST_CASE("graph components separate words with no ladder between them") {
+	auto const lexicon = std::unordered_set<std::string>{"cat", "cot", "cog", "dog", "elf", "ell", "zzz"};
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+
+	CHECK(graph.component(*graph.find("cat")) == graph.component(*graph.find("dog")));
+	CHECK(graph.component(*graph.find("elf")) == graph.component(*graph.find("ell")));
+	CHECK(graph.component(*graph.find("cat")) != graph.component(*graph.find("elf")));
+	CHECK(graph.component(*graph.find("zzz")) != graph.component(*graph.find("ell")));
+	CHECK(graph.landmark_count() == 0);
+	CHECK(graph.lower_bound(*graph.find("cat"), *graph.find("elf")) == ::word_ladder::unreachable_distance);
+	CHECK(::word_ladder::generate_landmarks("cat", "elf", graph).empty());
+}
+
+TEST_CASE("landmark bounds never exceed the true distance") {
+	auto const lexicon = std::unordered_set<std::string>{"cat", "cot", "cog", "dog", "dot", "cut", "hut", "hit"};
+	auto const base = ::word_ladder::build_graph_image(lexicon);
+	auto const image = ::word_ladder::build_landmarks(::word_ladder::graph_view(base.data()), 2);
+	auto const graph = ::word_ladder::graph_view(image.data());
+
+	REQUIRE(graph.landmark_count() == 2);
+	for (auto from = std::uint32_t{0}; from < graph.word_count(); ++from) {
+		for (auto to = std::uint32_t{0}; to < graph.word_count(); ++to) {
+			auto const ladders =
+			    ::word_ladder::generate(std::string(graph.word(from)), std::string(graph.word(to)), graph);
+			REQUIRE(not ladders.empty());
+			CHECK(graph.lower_bound(from, to) <= ladders.front().size() - 1);
+		}
+	}
+	// dog and hit differ in three letters but are six rungs apart; landmarks near the ends do better
+	CHECK(graph.lower_bound(*graph.find("dog"), *graph.find("hit")) > 3);
+}
+
+TEST_CASE("generate_landmarks matches generate, from a mapped snapshot") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const base = ::word_ladder::build_graph_image(lexicon);
+	auto const image = ::word_ladder::build_landmarks(::word_ladder::graph_view(base.data()), 4);
+	auto const path = "./lexicon_graph_test_" + std::to_string(::getpid()) + ".snapshot";
+	::word_ladder::save_graph_image(::word_ladder::graph_view(image.data()), path);
+	auto const mapped = ::word_ladder::shared_graph::map_file(path);
+	std::remove(path.c_str());
+	auto const graph = mapped.view();
+
+	CHECK(graph.landmark_count() == 4);
+	CHECK(graph.size_bytes() == image.size());
+	for (auto const& [from, to] : std::vector<std::pair<std::string, std::string>>{{"work", "play"},
+	                                                                              {"awake", "sleep"},
+	                                                                              {"dinner", "supper"},
+	                                                                              {"bulliest", "peppiest"},
+	                                                                              {"airplane", "tricycle"}}) {
+		CHECK(::word_ladder::generate_landmarks(from, to, graph) == ::word_ladder::generate(from, to, graph));
+	}
+	CHECK_THROWS(::word_ladder::shared_graph::map_file(path));
+}
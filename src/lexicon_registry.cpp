@@ -0,0 +1,69 @@
+#include "lexicon_registry.h"
+// data structures
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+// other functionality
+#include <mutex>
+#include <utility>
+
+/**
+ * @brief build the graph of a lexicon and keep both, tagged with a version
+ *
+ * @param lexicon - the words of this version
+ * @param version - the version number
+ */
+word_ladder::lexicon_snapshot::lexicon_snapshot(std::unordered_set<std::string> lexicon, std::uint64_t version)
+: lexicon_(std::move(lexicon))
+, image_(build_graph_image(lexicon_))
+, version_(version) {}
+
+auto word_ladder::lexicon_snapshot::lexicon() const -> const std::unordered_set<std::string>& {
+	return lexicon_;
+}
+
+auto word_ladder::lexicon_snapshot::graph() const -> graph_view {
+	return graph_view(image_.data());
+}
+
+auto word_ladder::lexicon_snapshot::version() const -> std::uint64_t {
+	return version_;
+}
+
+word_ladder::lexicon_registry::lexicon_registry(std::unordered_set<std::string> lexicon)
+: current_(std::make_shared<const lexicon_snapshot>(std::move(lexicon), 1)) {}
+
+auto word_ladder::lexicon_registry::current() const -> std::shared_ptr<const lexicon_snapshot> {
+	return current_.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief publish a new version of the lexicon. The expensive part, building the snapshot's graph,
+ * happens before the swap, so readers only ever contend with the swap itself, never with the build.
+ * The publish mutex keeps version numbers in publish order when several threads publish at once
+ *
+ * @param lexicon - the words of the new version
+ * @return std::uint64_t - the version number of the new snapshot
+ */
+auto word_ladder::lexicon_registry::publish(std::unordered_set<std::string> lexicon) -> std::uint64_t {
+	auto const lock = std::scoped_lock(publish_mutex_);
+	auto const version = current_.load(std::memory_order_relaxed)->version() + 1;
+	auto snapshot = std::make_shared<const lexicon_snapshot>(std::move(lexicon), version);
+	current_.store(std::move(snapshot), std::memory_order_release);
+	return version;
+}
+
+/**
+ * @brief generate all shortest word ladders on the current snapshot. The snapshot is pinned for the
+ * whole search, so a publish during the search does not affect it
+ *
+ * @param from - the source word
+ * @param to - the target word
+ * @return std::vector<std::vector<std::string>> - the list of solutions, in alphabetical order
+ */
+auto word_ladder::lexicon_registry::generate(const std::string& from, const std::string& to) const
+    -> std::vector<std::vector<std::string>> {
+	auto const snapshot = current();
+	return word_ladder::generate(from, to, snapshot->graph());
+}
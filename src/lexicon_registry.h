@@ -0,0 +1,59 @@
+#ifndef COMP6771_LEXICON_REGISTRY_H
+#define COMP6771_LEXICON_REGISTRY_H
+
+#include "lexicon_graph.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// One published version of the lexicon together with its graph. A snapshot never changes after it
+	// is built, so any number of threads can search it at once.
+	class lexicon_snapshot {
+	public:
+		lexicon_snapshot(std::unordered_set<std::string> lexicon, std::uint64_t version);
+
+		auto lexicon() const -> const std::unordered_set<std::string>&;
+		auto graph() const -> graph_view;
+		auto version() const -> std::uint64_t;
+
+	private:
+		std::unordered_set<std::string> lexicon_;
+		std::vector<std::byte> image_;
+		std::uint64_t version_;
+	};
+
+	// Holds the current lexicon snapshot of a long-running service and swaps in new ones while queries
+	// run, in the style of read-copy-update. A reader takes a reference to the current snapshot with
+	// one load of an atomic shared_ptr and keeps it for the whole query, so a query that started before
+	// a publish finishes on the old version, and the old version is freed when its last reader lets go.
+	// That load is not lock-free: libstdc++ guards the pointer with an internal spin lock, held by a
+	// reader only while it copies the pointer and bumps the count, and by a publisher only for the swap.
+	// Publishers build the new snapshot before the swap and serialise with each other on a mutex, so a
+	// reader never waits on a build.
+	class lexicon_registry {
+	public:
+		explicit lexicon_registry(std::unordered_set<std::string> lexicon);
+
+		// The snapshot new queries should use.
+		auto current() const -> std::shared_ptr<const lexicon_snapshot>;
+		// Builds a snapshot of lexicon and makes it current. Returns its version, which is one more than
+		// the version it replaces.
+		auto publish(std::unordered_set<std::string> lexicon) -> std::uint64_t;
+
+		// Same as generate, on the snapshot that is current when the call starts.
+		auto generate(const std::string& from, const std::string& to) const -> std::vector<std::vector<std::string>>;
+
+	private:
+		std::atomic<std::shared_ptr<const lexicon_snapshot>> current_;
+		std::mutex publish_mutex_;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_LEXICON_REGISTRY_H
@@ -0,0 +1,69 @@
+#include "lexicon_registry.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("registry serves the lexicon it was given") {
+	auto const registry = ::word_ladder::lexicon_registry({"cat", "cot", "cog", "dog"});
+	CHECK(registry.current()->version() == 1);
+	CHECK(registry.current()->lexicon().size() == 4);
+	CHECK(registry.generate("cat", "dog") == std::vector<std::vector<std::string>>{{"cat", "cot", "cog", "dog"}});
+}
+
+TEST_CASE("publishing swaps the lexicon for new queries but not for held snapshots") {
+	auto registry = ::word_ladder::lexicon_registry({"cat", "cot", "cog", "dog"});
+	auto const old_snapshot = registry.current();
+
+	CHECK(registry.publish({"cat", "cot", "dot", "cog", "dog"}) == 2);
+	CHECK(registry.current()->version() == 2);
+	CHECK(registry.generate("cat", "dog")
+	      == std::vector<std::vector<std::string>>{{"cat", "cot", "cog", "dog"}, {"cat", "cot", "dot", "dog"}});
+
+	// a query that pinned the old version still sees it, graph and all
+	CHECK(old_snapshot->version() == 1);
+	CHECK(not old_snapshot->lexicon().contains("dot"));
+	CHECK(::word_ladder::generate("cat", "dog", old_snapshot->graph())
+	      == std::vector<std::vector<std::string>>{{"cat", "cot", "cog", "dog"}});
+
+	CHECK(registry.publish({"cat", "dog"}) == 3);
+	CHECK(registry.generate("cat", "dog").empty());
+}
+
+TEST_CASE("readers see a complete snapshot while versions are published") {
+	// even versions ladder through cot and cog, odd ones through dat and dag, so every snapshot has
+	// exactly one shortest ladder and it tells the versions apart
+	auto const lexicon_for = [](std::uint64_t version) {
+		return version % 2 == 0 ? std::unordered_set<std::string>{"cat", "cot", "cog", "dog"}
+		                        : std::unordered_set<std::string>{"cat", "dat", "dag", "dog"};
+	};
+	auto registry = ::word_ladder::lexicon_registry(lexicon_for(1));
+	auto done = std::atomic<bool>{false};
+	auto bad_results = std::atomic<int>{0};
+
+	auto readers = std::vector<std::thread>{};
+	for (auto i = 0; i < 3; ++i) {
+		readers.emplace_back([&] {
+			while (not done.load()) {
+				auto const snapshot = registry.current();
+				auto const ladders = ::word_ladder::generate("cat", "dog", snapshot->graph());
+				auto const expected = ::word_ladder::generate("cat", "dog", lexicon_for(snapshot->version()));
+				if (ladders.size() != 1 or ladders != expected) {
+					++bad_results;
+				}
+			}
+		});
+	}
+	for (auto version = std::uint64_t{2}; version <= 200; ++version) {
+		CHECK(registry.publish(lexicon_for(version)) == version);
+	}
+	done = true;
+	for (auto& reader : readers) {
+		reader.join();
+	}
+	CHECK(bad_results == 0);
+}
@@ -0,0 +1,222 @@
+#include "line_tokenizer.h"
+// data structures
+#include <string_view>
+#include <vector>
+// other functionality
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#if defined(__x86_64__) || defined(__i386__)
+#	include <immintrin.h>
+#	define WORD_LADDER_X86 1
+#endif
+
+namespace {
+	// the text is classified in blocks of this many bytes, one bit per byte
+	constexpr auto block_bytes = std::size_t{64};
+	// and this many blocks per call to a kernel
+	constexpr auto batch_blocks = std::size_t{64};
+
+	/**
+	 * @brief the two masks of every block in a batch
+	 */
+	struct block_masks {
+		std::uint64_t newlines[batch_blocks];
+		std::uint64_t others[batch_blocks]; // neither a newline nor a lowercase letter
+	};
+
+	auto is_lower(char c) -> bool {
+		return c >= 'a' and c <= 'z';
+	}
+
+	auto is_blank(char c) -> bool {
+		return c == ' ' or c == '\t' or c == '\r' or c == '\v' or c == '\f';
+	}
+
+	/**
+	 * @brief portable kernel, written as byte loops the compiler can vectorise
+	 *
+	 * @param data - the first block
+	 * @param blocks - the number of blocks, at most batch_blocks
+	 * @param masks - where the masks of each block are written
+	 */
+	auto classify_scalar(const char* data, std::size_t blocks, block_masks& masks) -> void {
+		for (auto block = std::size_t{0}; block < blocks; ++block) {
+			auto const* bytes = data + block * block_bytes;
+			auto newlines = std::uint64_t{0};
+			auto others = std::uint64_t{0};
+			for (auto i = std::size_t{0}; i < block_bytes; ++i) {
+				newlines |= std::uint64_t{bytes[i] == '\n'} << i;
+				others |= std::uint64_t{bytes[i] != '\n' and not is_lower(bytes[i])} << i;
+			}
+			masks.newlines[block] = newlines;
+			masks.others[block] = others;
+		}
+	}
+
+#ifdef WORD_LADDER_X86
+	/**
+	 * @brief AVX2 kernel: two 32-byte compares per block. A byte is a lowercase letter if subtracting
+	 * 'a' leaves it at most 25 as an unsigned number
+	 */
+	[[gnu::target("avx2")]] auto classify_avx2(const char* data, std::size_t blocks, block_masks& masks) -> void {
+		auto const newline = _mm256_set1_epi8('\n');
+		auto const a = _mm256_set1_epi8('a');
+		auto const letters = _mm256_set1_epi8(25);
+		for (auto block = std::size_t{0}; block < blocks; ++block) {
+			auto const* bytes = data + block * block_bytes;
+			auto newlines = std::uint64_t{0};
+			auto others = std::uint64_t{0};
+			for (auto half = 0; half < 2; ++half) {
+				auto const chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + half * 32));
+				auto const is_newline = _mm256_cmpeq_epi8(chunk, newline);
+				auto const offset = _mm256_sub_epi8(chunk, a);
+				auto const is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, letters), offset);
+				auto const newline_bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(is_newline));
+				auto const other_bits =
+				    ~static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(is_newline, is_letter)));
+				newlines |= std::uint64_t{newline_bits} << (half * 32);
+				others |= std::uint64_t{other_bits} << (half * 32);
+			}
+			masks.newlines[block] = newlines;
+			masks.others[block] = others;
+		}
+	}
+
+	/**
+	 * @brief AVX-512 kernel: one 64-byte compare per block, straight into mask registers
+	 */
+	[[gnu::target("avx512f,avx512bw")]] auto classify_avx512(const char* data, std::size_t blocks, block_masks& masks)
+	    -> void {
+		auto const newline = _mm512_set1_epi8('\n');
+		auto const a = _mm512_set1_epi8('a');
+		auto const letters = _mm512_set1_epi8(25);
+		for (auto block = std::size_t{0}; block < blocks; ++block) {
+			auto const chunk = _mm512_loadu_si512(data + block * block_bytes);
+			auto const is_newline = _mm512_cmpeq_epi8_mask(chunk, newline);
+			auto const is_letter = _mm512_cmple_epu8_mask(_mm512_sub_epi8(chunk, a), letters);
+			masks.newlines[block] = is_newline;
+			masks.others[block] = ~(is_newline | is_letter);
+		}
+	}
+#endif
+
+	/**
+	 * @brief the lines of a text, fed to it one block of masks at a time
+	 */
+	class line_splitter {
+	public:
+		line_splitter(std::string_view text, std::vector<std::string_view>& words)
+		: text_(text)
+		, words_(words) {}
+
+		/**
+		 * @brief ends a line at every newline of the block. A line is dirty if it has any byte that is
+		 * not a letter, in this block or an earlier one
+		 *
+		 * @param base - the offset of the block in the text
+		 * @param newlines - the block's newline mask
+		 * @param others - the block's mask of bytes that are neither newlines nor letters
+		 */
+		auto add_block(std::size_t base, std::uint64_t newlines, std::uint64_t others) -> void {
+			auto from = 0;
+			while (newlines != 0) {
+				auto const position = std::countr_zero(newlines);
+				auto const before = (std::uint64_t{1} << position) - 1;
+				dirty_ = dirty_ or (others & before) >> from != 0;
+				end_line(base + static_cast<std::size_t>(position));
+				from = position + 1;
+				newlines &= newlines - 1;
+			}
+			if (from < 64) {
+				dirty_ = dirty_ or others >> from != 0;
+			}
+		}
+
+		/**
+		 * @brief classifies the bytes after the last whole block one at a time, and ends the last line
+		 *
+		 * @param base - the offset of the first byte not in a block
+		 * @return std::size_t - the number of lines rejected
+		 */
+		auto finish(std::size_t base) -> std::size_t {
+			for (auto i = base; i < text_.size(); ++i) {
+				if (text_[i] == '\n') {
+					end_line(i);
+				}
+				else if (not is_lower(text_[i])) {
+					dirty_ = true;
+				}
+			}
+			if (start_ < text_.size()) {
+				end_line(text_.size());
+			}
+			return rejected_;
+		}
+
+	private:
+		auto end_line(std::size_t end) -> void {
+			auto word = text_.substr(start_, end - start_);
+			start_ = end + 1;
+			if (dirty_) {
+				dirty_ = false;
+				while (not word.empty() and is_blank(word.front())) {
+					word.remove_prefix(1);
+				}
+				while (not word.empty() and is_blank(word.back())) {
+					word.remove_suffix(1);
+				}
+				if (not std::all_of(word.begin(), word.end(), is_lower)) {
+					++rejected_;
+					return;
+				}
+			}
+			if (not word.empty()) {
+				words_.push_back(word);
+			}
+		}
+
+		std::string_view text_;
+		std::vector<std::string_view>& words_;
+		std::size_t start_ = 0;
+		bool dirty_ = false;
+		std::size_t rejected_ = 0;
+	};
+} // namespace
+
+/**
+ * @brief split a word list into words with the widest kernel available, then finish the bytes past
+ * the last whole block one at a time
+ *
+ * @param text - the word list
+ * @param words - where the words are added, as views into text
+ * @param kernel - the instructions to classify the text with
+ * @return std::size_t - the number of lines rejected for holding something other than a word
+ */
+auto word_ladder::tokenize_words(std::string_view text, std::vector<std::string_view>& words, scan_kernel kernel)
+    -> std::size_t {
+	auto classify = &classify_scalar;
+#ifdef WORD_LADDER_X86
+	kernel = std::min(kernel, best_scan_kernel());
+	if (kernel == scan_kernel::avx512) {
+		classify = &classify_avx512;
+	}
+	else if (kernel == scan_kernel::avx2) {
+		classify = &classify_avx2;
+	}
+#else
+	static_cast<void>(kernel);
+#endif
+
+	auto splitter = line_splitter(text, words);
+	auto masks = block_masks{};
+	auto const full_blocks = text.size() / block_bytes;
+	for (auto first = std::size_t{0}; first < full_blocks; first += batch_blocks) {
+		auto const blocks = std::min(batch_blocks, full_blocks - first);
+		classify(text.data() + first * block_bytes, blocks, masks);
+		for (auto block = std::size_t{0}; block < blocks; ++block) {
+			splitter.add_block((first + block) * block_bytes, masks.newlines[block], masks.others[block]);
+		}
+	}
+	return splitter.finish(full_blocks * block_bytes);
+}
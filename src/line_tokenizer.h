@@ -0,0 +1,23 @@
+#ifndef COMP6771_LINE_TOKENIZER_H
+#define COMP6771_LINE_TOKENIZER_H
+
+#include "neighbour_scan.h"
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace word_ladder {
+	// Splits a newline-separated word list into words, the way every lexicon loader reads its input.
+	// The text is classified 64 bytes at a time with vector compares: one mask marks the newlines and
+	// another every byte that is not a lowercase letter. Lines with no such byte, which is nearly all of
+	// them, are taken as they are. The rest have spaces, tabs and carriage returns trimmed from both
+	// ends; they are skipped if nothing is left, and rejected if anything but a–z remains.
+	// Appends the words to words, as views into text, and returns the number of lines rejected.
+	// Uses kernel if the CPU supports it, otherwise the best kernel it does support.
+	auto tokenize_words(std::string_view text,
+	                    std::vector<std::string_view>& words,
+	                    scan_kernel kernel = best_scan_kernel()) -> std::size_t;
+} // namespace word_ladder
+
+#endif // COMP6771_LINE_TOKENIZER_H
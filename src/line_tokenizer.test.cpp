@@ -0,0 +1,76 @@
+#include "line_tokenizer.h"
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+	auto const kernels = std::vector<::word_ladder::scan_kernel>{::word_ladder::scan_kernel::scalar,
+	                                                             ::word_ladder::scan_kernel::avx2,
+	                                                             ::word_ladder::scan_kernel::avx512};
+
+	// a line at a time, as the tokenizer is documented to behave
+	auto reference_tokenize(std::string_view text, std::vector<std::string_view>& words) -> std::size_t {
+		auto rejected = std::size_t{0};
+		while (not text.empty()) {
+			auto const end = std::min(text.find('\n'), text.size());
+			auto line = text.substr(0, end);
+			text.remove_prefix(std::min(end + 1, text.size()));
+			auto const first = line.find_first_not_of(" \t\r\v\f");
+			line = first == std::string_view::npos ? std::string_view{} : line.substr(first);
+			line = line.substr(0, line.find_last_not_of(" \t\r\v\f") + 1);
+			if (line.find_first_not_of("abcdefghijklmnopqrstuvwxyz") != std::string_view::npos) {
+				++rejected;
+			}
+			else if (not line.empty()) {
+				words.push_back(line);
+			}
+		}
+		return rejected;
+	}
+} // namespace
+
+TEST_CASE("tokenizer splits lines, trims blanks and rejects other characters") {
+	auto const text = std::string("cat\r\ndog\n\n  bird \nCat\nc4t\nemu\n\t\r\nfish");
+	for (auto const kernel : kernels) {
+		auto words = std::vector<std::string_view>{};
+		CHECK(::word_ladder::tokenize_words(text, words, kernel) == 2);
+		CHECK(words == std::vector<std::string_view>{"cat", "dog", "bird", "emu", "fish"});
+	}
+	auto words = std::vector<std::string_view>{};
+	CHECK(::word_ladder::tokenize_words("", words) == 0);
+	CHECK(::word_ladder::tokenize_words("\n\n", words) == 0);
+	CHECK(::word_ladder::tokenize_words("two words\nnon-ascii \xc3\xa9\n", words) == 2);
+	CHECK(words.empty());
+}
+
+TEST_CASE("every kernel matches a line-at-a-time reference") {
+	// lines of every length up to 150, so they start and end at every offset of a block and span
+	// several blocks, with a blank, carriage return or bad byte mixed into some of them
+	auto text = std::string{};
+	auto seed = std::uint32_t{12345};
+	auto const next = [&seed] {
+		seed = seed * 1103515245 + 12345;
+		return seed >> 16;
+	};
+	for (auto line = 0; line < 3000; ++line) {
+		auto const length = next() % 150;
+		for (auto i = std::uint32_t{0}; i < length; ++i) {
+			auto const roll = next() % 1000;
+			text += roll == 0 ? ' ' : roll == 1 ? 'Q' : roll == 2 ? '\xff' : static_cast<char>('a' + roll % 26);
+		}
+		text += next() % 7 == 0 ? "\r\n" : "\n";
+	}
+	text += "tail";
+
+	auto expected = std::vector<std::string_view>{};
+	auto const expected_rejected = reference_tokenize(text, expected);
+	CHECK(expected_rejected > 0);
+	for (auto const kernel : kernels) {
+		auto words = std::vector<std::string_view>{};
+		CHECK(::word_ladder::tokenize_words(text, words, kernel) == expected_rejected);
+		CHECK(words == expected);
+	}
+}
@@ -0,0 +1,185 @@
+#include "neighbour_index.h"
+// data structures
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+// other functionality
+#include <algorithm>
+#include <numeric>
+
+namespace {
+	/**
+	 * @brief orders two words of the same length by what is left of them with one position deleted
+	 *
+	 * @param word1 - the first word
+	 * @param word2 - the second word
+	 * @param position - the position to delete
+	 * @return int - negative, zero or positive as word1 without the position comes before, equals or
+	 * comes after word2 without it
+	 */
+	auto compare_without(std::string_view word1, std::string_view word2, std::size_t position) -> int {
+		auto const prefix = word1.substr(0, position).compare(word2.substr(0, position));
+		return prefix != 0 ? prefix : word1.substr(position + 1).compare(word2.substr(position + 1));
+	}
+
+	/**
+	 * @brief sorts the words of each length into buckets indexed by length
+	 *
+	 * @param lexicon - the dictionary
+	 * @param words - where the words go, one alphabetical list per length
+	 */
+	auto sort_by_length(const std::unordered_set<std::string>& lexicon, std::vector<std::vector<std::string>>& words)
+	    -> void {
+		for (auto const& word : lexicon) {
+			if (word.size() >= words.size()) {
+				words.resize(word.size() + 1);
+			}
+			words[word.size()].push_back(word);
+		}
+		for (auto& same_length : words) {
+			std::sort(same_length.begin(), same_length.end());
+		}
+	}
+} // namespace
+
+/**
+ * @brief number the words of each length alphabetically, then add each word's number to the bucket of
+ * every one of its wildcard keys. The words are added in order, so every bucket comes out ascending
+ *
+ * @param lexicon - the dictionary to index
+ */
+word_ladder::wildcard_index::wildcard_index(const std::unordered_set<std::string>& lexicon) {
+	sort_by_length(lexicon, words_);
+	buckets_.reserve(lexicon.size() * 8);
+	for (auto const& same_length : words_) {
+		for (auto index = std::size_t{0}; index < same_length.size(); ++index) {
+			auto key = same_length[index];
+			for (auto i = std::size_t{0}; i < key.size(); ++i) {
+				key[i] = '*';
+				buckets_[key].push_back(static_cast<std::uint32_t>(index));
+				key[i] = same_length[index][i];
+			}
+		}
+	}
+}
+
+auto word_ladder::wildcard_index::words_of_length(std::size_t length) const -> std::span<const std::string> {
+	if (length >= words_.size()) {
+		return {};
+	}
+	return words_[length];
+}
+
+/**
+ * @brief gather the members of the word's buckets other than the word itself. A neighbour differs at
+ * one position only, so it is in exactly one of them
+ *
+ * @param word - the word to find the neighbours of; it need not be in the lexicon
+ * @return std::vector<std::uint32_t> - the neighbours' indexes among the words of their length, ascending
+ */
+auto word_ladder::wildcard_index::neighbour_indexes(std::string_view word) const -> std::vector<std::uint32_t> {
+	auto indexes = std::vector<std::uint32_t>{};
+	auto const words = words_of_length(word.size());
+	auto key = std::string(word);
+	for (auto i = std::size_t{0}; i < key.size(); ++i) {
+		key[i] = '*';
+		auto const bucket = buckets_.find(key);
+		if (bucket != buckets_.end()) {
+			for (auto const index : bucket->second) {
+				if (words[index][i] != word[i]) {
+					indexes.push_back(index);
+				}
+			}
+		}
+		key[i] = word[i];
+	}
+	std::sort(indexes.begin(), indexes.end());
+	return indexes;
+}
+
+auto word_ladder::wildcard_index::neighbours(std::string_view word) const -> std::vector<std::string> {
+	auto const words = words_of_length(word.size());
+	auto adjacent_words = std::vector<std::string>{};
+	for (auto const index : neighbour_indexes(word)) {
+		adjacent_words.push_back(words[index]);
+	}
+	return adjacent_words;
+}
+
+/**
+ * @brief number the words of each length alphabetically, then sort the numbers once per position by
+ * the words with that position deleted. Words equal apart from the deleted position end up side by
+ * side, in alphabetical order
+ *
+ * @param lexicon - the dictionary to index
+ */
+word_ladder::deletion_index::deletion_index(const std::unordered_set<std::string>& lexicon) {
+	auto words = std::vector<std::vector<std::string>>{};
+	sort_by_length(lexicon, words);
+	buckets_.resize(words.size());
+	for (auto length = std::size_t{0}; length < words.size(); ++length) {
+		auto& bucket = buckets_[length];
+		bucket.words = std::move(words[length]);
+		auto const count = bucket.words.size();
+		bucket.orders.resize(length * count);
+		for (auto position = std::size_t{0}; position < length; ++position) {
+			auto const order = bucket.orders.begin() + static_cast<std::ptrdiff_t>(position * count);
+			std::iota(order, order + static_cast<std::ptrdiff_t>(count), std::uint32_t{0});
+			// equal keys keep their alphabetical order, since the deleted letter is all that tells them apart
+			std::stable_sort(order, order + static_cast<std::ptrdiff_t>(count), [&](std::uint32_t a, std::uint32_t b) {
+				return compare_without(bucket.words[a], bucket.words[b], position) < 0;
+			});
+		}
+	}
+}
+
+auto word_ladder::deletion_index::words_of_length(std::size_t length) const -> std::span<const std::string> {
+	if (length >= buckets_.size()) {
+		return {};
+	}
+	return buckets_[length].words;
+}
+
+/**
+ * @brief for each position, binary search the words sorted with that position deleted for the ones
+ * that match the word apart from it. Every match except the word itself is a neighbour
+ *
+ * @param word - the word to find the neighbours of; it need not be in the lexicon
+ * @return std::vector<std::uint32_t> - the neighbours' indexes among the words of their length, ascending
+ */
+auto word_ladder::deletion_index::neighbour_indexes(std::string_view word) const -> std::vector<std::uint32_t> {
+	auto indexes = std::vector<std::uint32_t>{};
+	if (word.size() >= buckets_.size()) {
+		return indexes;
+	}
+	auto const& bucket = buckets_[word.size()];
+	auto const count = bucket.words.size();
+	for (auto position = std::size_t{0}; position < word.size(); ++position) {
+		auto const order = bucket.orders.begin() + static_cast<std::ptrdiff_t>(position * count);
+		auto const end = order + static_cast<std::ptrdiff_t>(count);
+		auto const first = std::lower_bound(order, end, word, [&](std::uint32_t index, std::string_view key) {
+			return compare_without(bucket.words[index], key, position) < 0;
+		});
+		auto const last = std::upper_bound(first, end, word, [&](std::string_view key, std::uint32_t index) {
+			return compare_without(key, bucket.words[index], position) < 0;
+		});
+		for (auto match = first; match != last; ++match) {
+			if (bucket.words[*match][position] != word[position]) {
+				indexes.push_back(*match);
+			}
+		}
+	}
+	std::sort(indexes.begin(), indexes.end());
+	return indexes;
+}
+
+auto word_ladder::deletion_index::neighbours(std::string_view word) const -> std::vector<std::string> {
+	auto const words = words_of_length(word.size());
+	auto adjacent_words = std::vector<std::string>{};
+	for (auto const index : neighbour_indexes(word)) {
+		adjacent_words.push_back(words[index]);
+	}
+	return adjacent_words;
+}
@@ -0,0 +1,62 @@
+#ifndef COMP6771_NEIGHBOUR_INDEX_H
+#define COMP6771_NEIGHBOUR_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// Finds neighbours through wildcard buckets: one hash map entry per word and position with that
+	// letter blanked out ("c*t" holds cat, cot and cut), so the neighbours of a word are the other
+	// members of its buckets. A lookup is one hash probe per letter, but every key is a string of its
+	// own, so the index takes several times the memory of the words.
+	class wildcard_index {
+	public:
+		explicit wildcard_index(const std::unordered_set<std::string>& lexicon);
+
+		// The words of one length, in alphabetical order.
+		auto words_of_length(std::size_t length) const -> std::span<const std::string>;
+		// Every word that differs from word in exactly one letter, in alphabetical order.
+		auto neighbours(std::string_view word) const -> std::vector<std::string>;
+		// Same as neighbours, as indexes into words_of_length(word.size()).
+		auto neighbour_indexes(std::string_view word) const -> std::vector<std::uint32_t>;
+
+	private:
+		std::vector<std::vector<std::string>> words_;
+		// the indexes of the bucket's words among the words of their length, ascending
+		std::unordered_map<std::string, std::vector<std::uint32_t>> buckets_;
+	};
+
+	// Finds neighbours through the deletion neighbourhood: two words of the same length are neighbours
+	// exactly when deleting the letter they differ at leaves the same word. For every length and
+	// position the words are kept sorted by what is left with that position deleted, as an array of
+	// indexes, so the neighbours at a position are one equal range found by binary search. The index
+	// takes four bytes per letter of the lexicon and no keys, at the cost of a log n search per letter.
+	class deletion_index {
+	public:
+		explicit deletion_index(const std::unordered_set<std::string>& lexicon);
+
+		// The words of one length, in alphabetical order.
+		auto words_of_length(std::size_t length) const -> std::span<const std::string>;
+		// Every word that differs from word in exactly one letter, in alphabetical order.
+		auto neighbours(std::string_view word) const -> std::vector<std::string>;
+		// Same as neighbours, as indexes into words_of_length(word.size()).
+		auto neighbour_indexes(std::string_view word) const -> std::vector<std::uint32_t>;
+
+	private:
+		struct bucket {
+			std::vector<std::string> words;
+			// for position p, orders[p * words.size() + k] is the k-th word with letter p deleted
+			std::vector<std::uint32_t> orders;
+		};
+
+		std::vector<bucket> buckets_;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_NEIGHBOUR_INDEX_H
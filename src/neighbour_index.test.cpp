@@ -0,0 +1,64 @@
+#include "neighbour_index.h"
+#include "neighbour_provider.h"
+#include "neighbour_scan.h"
+#include "neighbour_trie.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <vector>
+
+TEST_CASE("wildcard and deletion indexes find the same neighbours") {
+	auto const lexicon = std::unordered_set<std::string>{"cat", "cot", "cut", "cog", "dot", "at", "cats", "bat"};
+	auto const wildcard = ::word_ladder::wildcard_index(lexicon);
+	auto const deletion = ::word_ladder::deletion_index(lexicon);
+	CHECK(wildcard.words_of_length(3).size() == 6);
+	CHECK(deletion.words_of_length(3).size() == 6);
+
+	CHECK(wildcard.neighbours("cot") == std::vector<std::string>{"cat", "cog", "cut", "dot"});
+	CHECK(deletion.neighbours("cot") == std::vector<std::string>{"cat", "cog", "cut", "dot"});
+	CHECK(wildcard.neighbour_indexes("cat") == std::vector<std::uint32_t>{0, 3, 4});
+	CHECK(deletion.neighbour_indexes("cat") == std::vector<std::uint32_t>{0, 3, 4});
+	// words outside the lexicon and lengths it does not have
+	CHECK(wildcard.neighbours("cxt") == std::vector<std::string>{"cat", "cot", "cut"});
+	CHECK(deletion.neighbours("cxt") == std::vector<std::string>{"cat", "cot", "cut"});
+	CHECK(wildcard.neighbours("catsup").empty());
+	CHECK(deletion.neighbours("catsup").empty());
+	CHECK(deletion.neighbours("").empty());
+}
+
+TEST_CASE("both indexes match the trie walk on english") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const wildcard = ::word_ladder::wildcard_index(lexicon);
+	auto const deletion = ::word_ladder::deletion_index(lexicon);
+	auto const trie = ::word_ladder::neighbour_trie(lexicon);
+	for (auto length = std::size_t{1}; length <= 29; ++length) {
+		auto const words = trie.words_of_length(length);
+		REQUIRE(deletion.words_of_length(length).size() == words.size());
+		for (auto i = std::size_t{0}; i < words.size(); i += 101) {
+			auto const expected = trie.neighbour_indexes(words[i]);
+			CHECK(wildcard.neighbour_indexes(words[i]) == expected);
+			CHECK(deletion.neighbour_indexes(words[i]) == expected);
+		}
+	}
+}
+
+TEST_CASE("generate over any provider matches the lexicon search") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const wildcard = ::word_ladder::wildcard_index(lexicon);
+	auto const deletion = ::word_ladder::deletion_index(lexicon);
+	auto const scan = ::word_ladder::neighbour_scan(lexicon);
+	auto const trie = ::word_ladder::neighbour_trie(lexicon);
+
+	auto const pairs = std::vector<std::pair<std::string, std::string>>{
+	    {"work", "play"}, {"code", "data"}, {"awake", "sleep"}, {"at", "it"}, {"airplane", "tricycle"}};
+	for (auto const& [from, to] : pairs) {
+		auto const expected = ::word_ladder::generate(from, to, lexicon);
+		CHECK(::word_ladder::generate(from, to, wildcard) == expected);
+		CHECK(::word_ladder::generate(from, to, deletion) == expected);
+		CHECK(::word_ladder::generate(from, to, scan) == expected);
+		CHECK(::word_ladder::generate(from, to, trie) == expected);
+	}
+	CHECK(::word_ladder::generate("cat", "cot", ::word_ladder::deletion_index({"cat"})).empty());
+}
@@ -0,0 +1,30 @@
+#include "neighbour_provider.h"
+// data structures
+#include <string_view>
+#include <vector>
+
+word_ladder::graph_provider::graph_provider(graph_view graph)
+: graph_(graph) {}
+
+auto word_ladder::graph_provider::words_of_length(std::size_t length) const -> word_range {
+	auto const [first, last] = graph_.ids_of_length(length);
+	return std::views::iota(std::uint32_t{0}, last - first) | std::views::transform(word_at{graph_, first});
+}
+
+/**
+ * @brief look the word up, then renumber its adjacency list from graph ids to indexes within its
+ * length. The list is ascending, and so are the indexes
+ *
+ * @param word - the word to find the neighbours of; words outside the graph have none
+ * @return std::vector<std::uint32_t> - the neighbours' indexes among the words of their length, ascending
+ */
+auto word_ladder::graph_provider::neighbour_indexes(std::string_view word) const -> std::vector<std::uint32_t> {
+	auto indexes = std::vector<std::uint32_t>{};
+	if (auto const id = graph_.find(word)) {
+		auto const first = graph_.ids_of_length(word.size()).first;
+		for (auto const neighbour : graph_.neighbours(*id)) {
+			indexes.push_back(neighbour - first);
+		}
+	}
+	return indexes;
+}
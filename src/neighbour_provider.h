@@ -0,0 +1,289 @@
+#ifndef COMP6771_NEIGHBOUR_PROVIDER_H
+#define COMP6771_NEIGHBOUR_PROVIDER_H
+
+#include "lexicon_graph.h"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace word_ladder {
+	// A neighbour provider is any index that numbers the words of each length alphabetically and finds
+	// the neighbours of a word by number. The search below is written once against this concept, so a
+	// new index is compared with the others without touching it.
+	template<typename Provider>
+	concept neighbour_provider = requires(const Provider& provider, std::string_view word, std::size_t length) {
+		// the words of one length, in alphabetical order
+		{ provider.words_of_length(length) } -> std::ranges::random_access_range;
+		{ provider.words_of_length(length)[std::uint32_t{0}] } -> std::convertible_to<std::string_view>;
+		// the indexes of word's neighbours among the words of its length, ascending
+		{ provider.neighbour_indexes(word) } -> std::same_as<std::vector<std::uint32_t>>;
+	};
+
+	// The original search as a provider: every letter at every position is substituted and looked up
+	// in the hash set. The words are viewed, not copied, so the lexicon must outlive the provider and
+	// not change.
+	template<typename Lexicon>
+	class substitution_provider {
+	public:
+		explicit substitution_provider(const Lexicon& lexicon)
+		: substitution_provider(lexicon, std::numeric_limits<std::size_t>::max()) {}
+		// Numbers only the words of one length, which is all a search needs.
+		substitution_provider(const Lexicon& lexicon, std::size_t length);
+
+		auto words_of_length(std::size_t length) const -> std::span<const std::string_view>;
+		auto neighbour_indexes(std::string_view word) const -> std::vector<std::uint32_t>;
+
+	private:
+		const Lexicon* lexicon_;
+		std::vector<std::vector<std::string_view>> words_;
+	};
+
+	// A prebuilt graph as a provider: the neighbours of a word are read straight off its adjacency
+	// list. The graph's ids of one length are contiguous and alphabetical, so a word's index is its id
+	// less the first id of its length. The image must outlive the provider.
+	class graph_provider {
+	public:
+		explicit graph_provider(graph_view graph);
+
+		// the word with an index among the words of one length
+		struct word_at {
+			graph_view graph;
+			std::uint32_t first;
+			auto operator()(std::uint32_t index) const -> std::string_view {
+				return graph.word(first + index);
+			}
+		};
+		using word_range =
+		    std::ranges::transform_view<std::ranges::iota_view<std::uint32_t, std::uint32_t>, word_at>;
+
+		auto words_of_length(std::size_t length) const -> word_range;
+		auto neighbour_indexes(std::string_view word) const -> std::vector<std::uint32_t>;
+
+	private:
+		graph_view graph_;
+	};
+
+	namespace detail {
+		constexpr auto unreached = std::numeric_limits<std::uint32_t>::max();
+
+		// A search budget that never runs out. A budget is asked exhausted() for every word expanded
+		// and exhausted_now() at every level, and the search gives up once either is true.
+		struct unlimited_budget {
+			auto exhausted() const -> bool {
+				return false;
+			}
+			auto exhausted_now() const -> bool {
+				return false;
+			}
+		};
+
+		// The first phase of every shortest-ladder search here: a breadth-first search backward from
+		// target that sets distances[id - first] to the rungs from id to target, one level at a time,
+		// stopping after the level source is on. distances is indexed like a std::vector and must be
+		// unreached everywhere on entry; it may grow while neighbours runs.
+		template<typename Neighbours, typename Distances, typename Budget>
+		auto label_distances(std::uint32_t target,
+		                     std::uint32_t source,
+		                     std::uint32_t first,
+		                     Distances& distances,
+		                     const Neighbours& neighbours,
+		                     Budget& budget) -> void {
+			distances[target - first] = 0;
+			auto level = std::vector<std::uint32_t>{target};
+			auto next_level = std::vector<std::uint32_t>{};
+			for (auto depth = std::uint32_t{1}; not level.empty() and distances[source - first] == unreached;
+			     ++depth) {
+				if (budget.exhausted_now()) {
+					return;
+				}
+				next_level.clear();
+				for (auto const id : level) {
+					if (budget.exhausted()) {
+						return;
+					}
+					for (auto const neighbour : neighbours(id)) {
+						if (distances[neighbour - first] == unreached) {
+							distances[neighbour - first] = depth;
+							next_level.push_back(neighbour);
+						}
+					}
+				}
+				std::swap(level, next_level);
+			}
+		}
+
+		// The second phase: a depth-first walk on from the last word of path that only steps to
+		// neighbours one rung closer to target, so every ladder it starts finishes. Given each word's
+		// neighbours in alphabetical order, it passes the ladders to emit in alphabetical order.
+		// Returns false once emit returns false or the budget runs out.
+		template<typename Neighbours, typename Distance, typename Emit, typename Budget>
+		auto walk_closer(std::vector<std::uint32_t>& path,
+		                 std::uint32_t target,
+		                 const Neighbours& neighbours,
+		                 const Distance& distance,
+		                 const Emit& emit,
+		                 Budget& budget) -> bool {
+			auto const id = path.back();
+			if (id == target) {
+				return emit(std::as_const(path));
+			}
+			auto const closer = distance(id) - 1;
+			for (auto const neighbour : neighbours(id)) {
+				if (distance(neighbour) != closer) {
+					continue;
+				}
+				if (budget.exhausted()) {
+					return false;
+				}
+				path.push_back(neighbour);
+				auto const more = walk_closer(path, target, neighbours, distance, emit, budget);
+				path.pop_back();
+				if (not more) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		// Both phases over a neighbour provider, adding up to limit ladders to paths in alphabetical
+		// order. Each word's neighbours are looked up again on the walk, but only once however many
+		// ladders pass through it.
+		template<neighbour_provider Provider, typename Budget>
+		auto provider_ladders(const std::string& from,
+		                      const std::string& to,
+		                      const Provider& provider,
+		                      std::size_t limit,
+		                      Budget& budget,
+		                      std::vector<std::vector<std::string>>& paths) -> void {
+			auto const words = provider.words_of_length(from.size());
+			auto const find = [&](std::string_view word) {
+				auto const found = std::ranges::lower_bound(words, word);
+				return found != std::ranges::end(words) and *found == word
+				           ? static_cast<std::uint32_t>(found - std::ranges::begin(words))
+				           : unreached;
+			};
+			auto const source = find(from);
+			auto const target = find(to);
+			if (source == unreached or target == unreached or from.size() != to.size() or limit == 0) {
+				return;
+			}
+
+			auto distances = std::vector<std::uint32_t>(std::ranges::size(words), unreached);
+			label_distances(
+			    target,
+			    source,
+			    0,
+			    distances,
+			    [&](std::uint32_t index) { return provider.neighbour_indexes(words[index]); },
+			    budget);
+			if (distances[source] == unreached or budget.exhausted_now()) {
+				return;
+			}
+
+			auto known = std::unordered_map<std::uint32_t, std::vector<std::uint32_t>>{};
+			auto const neighbours = [&](std::uint32_t index) -> const std::vector<std::uint32_t>& {
+				auto [found, inserted] = known.try_emplace(index);
+				if (inserted) {
+					found->second = provider.neighbour_indexes(words[index]);
+				}
+				return found->second;
+			};
+			auto path = std::vector<std::uint32_t>{source};
+			walk_closer(
+			    path,
+			    target,
+			    neighbours,
+			    [&](std::uint32_t index) { return distances[index]; },
+			    [&](const std::vector<std::uint32_t>& ladder) {
+				    auto& words_of_ladder = paths.emplace_back();
+				    for (auto const index : ladder) {
+					    words_of_ladder.emplace_back(words[index]);
+				    }
+				    return paths.size() < limit;
+			    },
+			    budget);
+		}
+	} // namespace detail
+
+	// Same as the lexicon overload of generate, searching the words of from's length through a
+	// neighbour provider, which can be any of substitution_provider, graph_provider, wildcard_index,
+	// deletion_index, neighbour_scan and neighbour_trie. A breadth-first search backward from the
+	// target labels distances up to the start word's level, and a depth-first walk forward from the
+	// start word, only ever stepping one rung closer, produces the ladders in alphabetical order.
+	// Preconditions: as for generate.
+	template<neighbour_provider Provider>
+	auto generate(const std::string& from, const std::string& to, const Provider& provider)
+	    -> std::vector<std::vector<std::string>> {
+		auto paths = std::vector<std::vector<std::string>>{};
+		auto budget = detail::unlimited_budget{};
+		detail::provider_ladders(from, to, provider, std::numeric_limits<std::size_t>::max(), budget, paths);
+		return paths;
+	}
+
+	template<typename Lexicon>
+	substitution_provider<Lexicon>::substitution_provider(const Lexicon& lexicon, std::size_t length)
+	: lexicon_(&lexicon) {
+		auto const add = [&](std::string_view word) {
+			if (length != std::numeric_limits<std::size_t>::max() and word.size() != length) {
+				return;
+			}
+			if (word.size() >= words_.size()) {
+				words_.resize(word.size() + 1);
+			}
+			words_[word.size()].push_back(word);
+		};
+		for (auto const& word : lexicon) {
+			add(word);
+		}
+		for (auto& same_length : words_) {
+			std::sort(same_length.begin(), same_length.end());
+		}
+	}
+
+	template<typename Lexicon>
+	auto substitution_provider<Lexicon>::words_of_length(std::size_t length) const
+	    -> std::span<const std::string_view> {
+		if (length >= words_.size()) {
+			return {};
+		}
+		return words_[length];
+	}
+
+	// Tries every other letter at every position, as find_words does, and numbers each word found by a
+	// binary search of the words of its length. The word need not be in the lexicon.
+	template<typename Lexicon>
+	auto substitution_provider<Lexicon>::neighbour_indexes(std::string_view word) const
+	    -> std::vector<std::uint32_t> {
+		auto indexes = std::vector<std::uint32_t>{};
+		auto const words = words_of_length(word.size());
+		auto candidate = std::string(word);
+		for (auto i = std::size_t{0}; i < candidate.size(); ++i) {
+			for (auto c = 'a'; c <= 'z'; ++c) {
+				if (c == word[i]) {
+					continue;
+				}
+				candidate[i] = c;
+				if (lexicon_->contains(candidate)) {
+					auto const found = std::lower_bound(words.begin(), words.end(), std::string_view(candidate));
+					indexes.push_back(static_cast<std::uint32_t>(found - words.begin()));
+				}
+			}
+			candidate[i] = word[i];
+		}
+		std::sort(indexes.begin(), indexes.end());
+		return indexes;
+	}
+} // namespace word_ladder
+
+#endif // COMP6771_NEIGHBOUR_PROVIDER_H
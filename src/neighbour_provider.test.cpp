@@ -0,0 +1,63 @@
+#include "neighbour_provider.h"
+#include "lexicon_graph.h"
+#include "neighbour_index.h"
+#include "neighbour_scan.h"
+#include "neighbour_trie.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+static_assert(::word_ladder::neighbour_provider<::word_ladder::substitution_provider<std::unordered_set<std::string>>>);
+static_assert(::word_ladder::neighbour_provider<::word_ladder::graph_provider>);
+static_assert(::word_ladder::neighbour_provider<::word_ladder::wildcard_index>);
+static_assert(::word_ladder::neighbour_provider<::word_ladder::deletion_index>);
+static_assert(::word_ladder::neighbour_provider<::word_ladder::neighbour_scan>);
+static_assert(::word_ladder::neighbour_provider<::word_ladder::neighbour_trie>);
+static_assert(not ::word_ladder::neighbour_provider<std::unordered_set<std::string>>);
+
+TEST_CASE("substitution and graph providers number words within their length") {
+	auto const lexicon = std::unordered_set<std::string>{"cat", "cot", "cut", "cog", "dot", "at", "cats", "bat"};
+	auto const substitution = ::word_ladder::substitution_provider(lexicon);
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_provider(::word_ladder::graph_view(image.data()));
+
+	CHECK(substitution.words_of_length(3).size() == 6);
+	CHECK(graph.words_of_length(3).size() == 6);
+	CHECK(graph.words_of_length(3)[1] == "cat");
+	CHECK(graph.words_of_length(4)[0] == "cats");
+	CHECK(graph.words_of_length(9).empty());
+
+	CHECK(substitution.neighbour_indexes("cat") == std::vector<std::uint32_t>{0, 3, 4});
+	CHECK(graph.neighbour_indexes("cat") == std::vector<std::uint32_t>{0, 3, 4});
+	CHECK(substitution.neighbour_indexes("cxt") == std::vector<std::uint32_t>{1, 3, 4});
+	CHECK(graph.neighbour_indexes("cxt").empty()); // the graph only knows its own words
+	CHECK(graph.neighbour_indexes("at").empty());
+
+	// a provider for one length numbers the same words the same way, and no others
+	auto const three_letters = ::word_ladder::substitution_provider(lexicon, 3);
+	CHECK(std::ranges::equal(three_letters.words_of_length(3), substitution.words_of_length(3)));
+	CHECK(three_letters.words_of_length(4).empty());
+	CHECK(three_letters.neighbour_indexes("cat") == std::vector<std::uint32_t>{0, 3, 4});
+}
+
+TEST_CASE("every provider gives the same ladders") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const substitution = ::word_ladder::substitution_provider(lexicon);
+	auto const graph = ::word_ladder::graph_provider(::word_ladder::graph_view(image.data()));
+	auto const trie = ::word_ladder::neighbour_trie(lexicon);
+
+	auto const pairs = std::vector<std::pair<std::string, std::string>>{
+	    {"work", "play"}, {"chi", "ego"}, {"awake", "sleep"}, {"at", "it"}, {"atlases", "cabaret"}};
+	for (auto const& [from, to] : pairs) {
+		auto const expected = ::word_ladder::generate(from, to, lexicon);
+		CHECK(::word_ladder::generate(from, to, substitution) == expected);
+		CHECK(::word_ladder::generate(from, to, graph) == expected);
+		CHECK(::word_ladder::generate(from, to, trie) == expected);
+	}
+}
@@ -0,0 +1,214 @@
+#include "neighbour_scan.h"
+// data structures
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+// other functionality
+#include <algorithm>
+#include <bit>
+#if defined(__x86_64__) || defined(__i386__)
+#	include <immintrin.h>
+#	define WORD_LADDER_X86 1
+#endif
+
+namespace {
+	// every kernel works on blocks of this many words, so the columns are padded to a multiple of it
+	constexpr auto block_size = std::size_t{64};
+
+	/**
+	 * @brief adds the words of one block whose bits are set in a mask to the output, skipping the
+	 * padding past the last word
+	 */
+	auto emit_block(std::uint64_t mask, std::size_t block, std::size_t count, std::vector<std::uint32_t>& out)
+	    -> void {
+		while (mask != 0) {
+			auto const index = block + static_cast<std::size_t>(std::countr_zero(mask));
+			if (index >= count) {
+				return;
+			}
+			out.push_back(static_cast<std::uint32_t>(index));
+			mask &= mask - 1;
+		}
+	}
+
+	/**
+	 * @brief portable kernel. For each word it tracks whether it has differed from the query once and
+	 * whether it has differed twice; neighbours have differed once but not twice
+	 *
+	 * @param columns - the words of one length, column by column
+	 * @param stride - the distance between columns
+	 * @param count - the number of words
+	 * @param word - the query, of the same length
+	 * @param out - where the indexes of the neighbours are added, ascending
+	 */
+	auto scan_scalar(const std::uint8_t* columns,
+	                 std::size_t stride,
+	                 std::size_t count,
+	                 std::string_view word,
+	                 std::vector<std::uint32_t>& out) -> void {
+		for (auto block = std::size_t{0}; block < count; block += block_size) {
+			std::uint8_t once[block_size] = {};
+			std::uint8_t twice[block_size] = {};
+			for (auto position = std::size_t{0}; position < word.size(); ++position) {
+				auto const* column = columns + position * stride + block;
+				auto const letter = static_cast<std::uint8_t>(word[position]);
+				for (auto i = std::size_t{0}; i < block_size; ++i) {
+					auto const differs = static_cast<std::uint8_t>(column[i] != letter);
+					twice[i] |= once[i] & differs;
+					once[i] |= differs;
+				}
+			}
+			auto mask = std::uint64_t{0};
+			for (auto i = std::size_t{0}; i < block_size; ++i) {
+				mask |= std::uint64_t{static_cast<std::uint8_t>(once[i] & ~twice[i])} << i;
+			}
+			emit_block(mask, block, count, out);
+		}
+	}
+
+#ifdef WORD_LADDER_X86
+	/**
+	 * @brief AVX2 kernel: the same once/twice tracking as scan_scalar, on 32 words per compare
+	 */
+	[[gnu::target("avx2")]] auto scan_avx2(const std::uint8_t* columns,
+	                                       std::size_t stride,
+	                                       std::size_t count,
+	                                       std::string_view word,
+	                                       std::vector<std::uint32_t>& out) -> void {
+		auto const all = _mm256_set1_epi8(-1);
+		for (auto block = std::size_t{0}; block < count; block += 32) {
+			auto once = _mm256_setzero_si256();
+			auto twice = _mm256_setzero_si256();
+			for (auto position = std::size_t{0}; position < word.size(); ++position) {
+				auto const column =
+				    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columns + position * stride + block));
+				auto const differs = _mm256_andnot_si256(_mm256_cmpeq_epi8(column, _mm256_set1_epi8(word[position])),
+				                                         all);
+				twice = _mm256_or_si256(twice, _mm256_and_si256(once, differs));
+				once = _mm256_or_si256(once, differs);
+				if (_mm256_testc_si256(twice, all) != 0) {
+					break;
+				}
+			}
+			auto const mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_andnot_si256(twice, once)));
+			emit_block(mask, block, count, out);
+		}
+	}
+
+	/**
+	 * @brief AVX-512 kernel: compares 64 words at once, straight into mask registers
+	 */
+	[[gnu::target("avx512f,avx512bw")]] auto scan_avx512(const std::uint8_t* columns,
+	                                                     std::size_t stride,
+	                                                     std::size_t count,
+	                                                     std::string_view word,
+	                                                     std::vector<std::uint32_t>& out) -> void {
+		for (auto block = std::size_t{0}; block < count; block += 64) {
+			auto once = __mmask64{0};
+			auto twice = __mmask64{0};
+			for (auto position = std::size_t{0}; position < word.size() and twice != ~__mmask64{0}; ++position) {
+				auto const column = _mm512_loadu_si512(columns + position * stride + block);
+				auto const differs = _mm512_cmpneq_epi8_mask(column, _mm512_set1_epi8(word[position]));
+				twice |= once & differs;
+				once |= differs;
+			}
+			emit_block(once & ~twice, block, count, out);
+		}
+	}
+#endif
+
+	auto supported(word_ladder::scan_kernel kernel) -> bool {
+		return kernel <= word_ladder::best_scan_kernel();
+	}
+} // namespace
+
+/**
+ * @brief detect the widest kernel the CPU running this process supports
+ *
+ * @return scan_kernel - avx512 needs AVX-512BW, avx2 needs AVX2, and scalar runs anywhere
+ */
+auto word_ladder::best_scan_kernel() -> scan_kernel {
+#ifdef WORD_LADDER_X86
+	if (__builtin_cpu_supports("avx512bw")) {
+		return scan_kernel::avx512;
+	}
+	if (__builtin_cpu_supports("avx2")) {
+		return scan_kernel::avx2;
+	}
+#endif
+	return scan_kernel::scalar;
+}
+
+/**
+ * @brief sort the lexicon into one bucket per word length and lay each bucket out column by column
+ *
+ * @param lexicon - the dictionary to scan
+ * @param kernel - the preferred kernel
+ */
+word_ladder::neighbour_scan::neighbour_scan(const std::unordered_set<std::string>& lexicon, scan_kernel kernel)
+: kernel_(supported(kernel) ? kernel : best_scan_kernel()) {
+	for (auto const& word : lexicon) {
+		if (word.size() >= buckets_.size()) {
+			buckets_.resize(word.size() + 1);
+		}
+		buckets_[word.size()].words.push_back(word);
+	}
+	for (auto length = std::size_t{0}; length < buckets_.size(); ++length) {
+		auto& bucket = buckets_[length];
+		std::sort(bucket.words.begin(), bucket.words.end());
+		bucket.stride = (bucket.words.size() + block_size - 1) / block_size * block_size;
+		bucket.columns.assign(length * bucket.stride, 0);
+		for (auto i = std::size_t{0}; i < bucket.words.size(); ++i) {
+			for (auto position = std::size_t{0}; position < length; ++position) {
+				bucket.columns[position * bucket.stride + i] = static_cast<std::uint8_t>(bucket.words[i][position]);
+			}
+		}
+	}
+}
+
+auto word_ladder::neighbour_scan::kernel() const -> scan_kernel {
+	return kernel_;
+}
+
+auto word_ladder::neighbour_scan::words_of_length(std::size_t length) const -> std::span<const std::string> {
+	if (length >= buckets_.size()) {
+		return {};
+	}
+	return buckets_[length].words;
+}
+
+/**
+ * @brief run the selected kernel over the bucket of the word's length
+ *
+ * @param word - the word to find the neighbours of; it need not be in the lexicon
+ * @return std::vector<std::uint32_t> - the neighbours' indexes in their bucket, ascending
+ */
+auto word_ladder::neighbour_scan::neighbour_indexes(std::string_view word) const -> std::vector<std::uint32_t> {
+	auto indexes = std::vector<std::uint32_t>{};
+	if (word.empty() or word.size() >= buckets_.size()) {
+		return indexes;
+	}
+	auto const& bucket = buckets_[word.size()];
+	switch (kernel_) {
+#ifdef WORD_LADDER_X86
+	case scan_kernel::avx512:
+		scan_avx512(bucket.columns.data(), bucket.stride, bucket.words.size(), word, indexes);
+		break;
+	case scan_kernel::avx2:
+		scan_avx2(bucket.columns.data(), bucket.stride, bucket.words.size(), word, indexes);
+		break;
+#endif
+	default: scan_scalar(bucket.columns.data(), bucket.stride, bucket.words.size(), word, indexes); break;
+	}
+	return indexes;
+}
+
+auto word_ladder::neighbour_scan::neighbours(std::string_view word) const -> std::vector<std::string> {
+	auto const words = words_of_length(word.size());
+	auto adjacent_words = std::vector<std::string>{};
+	for (auto const index : neighbour_indexes(word)) {
+		adjacent_words.push_back(words[index]);
+	}
+	return adjacent_words;
+}
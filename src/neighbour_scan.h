@@ -0,0 +1,50 @@
+#ifndef COMP6771_NEIGHBOUR_SCAN_H
+#define COMP6771_NEIGHBOUR_SCAN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// The instructions a neighbour_scan compares words with.
+	enum class scan_kernel { scalar, avx2, avx512 };
+
+	// The widest kernel this CPU supports.
+	auto best_scan_kernel() -> scan_kernel;
+
+	// Finds neighbours by comparing a word against every word of its length, instead of probing a hash
+	// set with every one-letter substitution. The words of each length are stored column by column,
+	// one byte per word per letter, so one vector compare tests the same letter of 32 (AVX2) or 64
+	// (AVX-512) words at once. This wins on short words, where a length has few words to scan.
+	class neighbour_scan {
+	public:
+		// Uses kernel if the CPU supports it, otherwise the best kernel it does support.
+		explicit neighbour_scan(const std::unordered_set<std::string>& lexicon,
+		                        scan_kernel kernel = best_scan_kernel());
+
+		auto kernel() const -> scan_kernel;
+		// The words of one length, in alphabetical order.
+		auto words_of_length(std::size_t length) const -> std::span<const std::string>;
+		// Every word that differs from word in exactly one letter, in alphabetical order.
+		auto neighbours(std::string_view word) const -> std::vector<std::string>;
+		// Same as neighbours, as indexes into words_of_length(word.size()).
+		auto neighbour_indexes(std::string_view word) const -> std::vector<std::uint32_t>;
+
+	private:
+		struct bucket {
+			std::vector<std::string> words;
+			// letter p of word i is at columns[p * stride + i]; stride is a whole number of vectors
+			std::vector<std::uint8_t> columns;
+			std::size_t stride = 0;
+		};
+
+		std::vector<bucket> buckets_;
+		scan_kernel kernel_;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_NEIGHBOUR_SCAN_H
@@ -0,0 +1,65 @@
+#include "neighbour_scan.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <string>
+
+/**
+ * @brief testing helper function to find neighbours the slow, obvious way
+ *
+ * @param word - the word to find the neighbours of
+ * @param lexicon - the dictionary
+ * @return std::vector<std::string> - every word one letter different from word, in alphabetical order
+ */
+auto substitution_neighbours(const std::string& word, const std::unordered_set<std::string>& lexicon)
+    -> std::vector<std::string> {
+	auto neighbours = std::vector<std::string>{};
+	auto candidate = word;
+	for (auto i = std::size_t{0}; i < word.size(); ++i) {
+		for (auto c = 'a'; c <= 'z'; ++c) {
+			if (c == word[i]) {
+				continue;
+			}
+			candidate[i] = c;
+			if (lexicon.contains(candidate)) {
+				neighbours.push_back(candidate);
+			}
+		}
+		candidate[i] = word[i];
+	}
+	std::sort(neighbours.begin(), neighbours.end());
+	return neighbours;
+}
+
+TEST_CASE("every scan kernel finds exactly the one-letter neighbours") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const kernel = GENERATE(::word_ladder::scan_kernel::scalar,
+	                             ::word_ladder::scan_kernel::avx2,
+	                             ::word_ladder::scan_kernel::avx512);
+	auto const scan = ::word_ladder::neighbour_scan(lexicon, kernel);
+	CHECK(scan.kernel() <= ::word_ladder::best_scan_kernel());
+
+	for (auto const* word : {"a", "at", "cat", "work", "sleep", "dinner", "walking", "peppiest", "derailing"}) {
+		CHECK(scan.neighbours(word) == substitution_neighbours(word, lexicon));
+	}
+	// a word of each length, including the longest ones and the last word of a bucket
+	for (auto length = std::size_t{1}; length <= 29; ++length) {
+		auto const words = scan.words_of_length(length);
+		if (not words.empty()) {
+			CHECK(scan.neighbours(words.back()) == substitution_neighbours(words.back(), lexicon));
+		}
+	}
+}
+
+TEST_CASE("scan handles words outside the lexicon") {
+	auto const lexicon = std::unordered_set<std::string>{"cat", "cot", "cut", "dog", "at"};
+	auto const scan = ::word_ladder::neighbour_scan(lexicon);
+
+	CHECK(scan.neighbours("cxt") == std::vector<std::string>{"cat", "cot", "cut"});
+	CHECK(scan.neighbour_indexes("cot") == std::vector<std::uint32_t>{0, 2});
+	CHECK(scan.neighbours("house").empty());
+	CHECK(scan.neighbours("").empty());
+	CHECK(scan.words_of_length(2).size() == 1);
+}
@@ -0,0 +1,118 @@
+#include "neighbour_trie.h"
+// data structures
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+// other functionality
+#include <algorithm>
+
+/**
+ * @brief sort the words of each length, then add one trie node for every letter past the prefix a
+ * word shares with the word before it. The words are sorted, so the children of every node are added
+ * one after another in alphabetical order, and each new node's children start wherever the next level
+ * ends at the time
+ *
+ * @param lexicon - the dictionary to index
+ */
+word_ladder::neighbour_trie::neighbour_trie(const std::unordered_set<std::string>& lexicon) {
+	for (auto const& word : lexicon) {
+		if (word.size() >= tries_.size()) {
+			tries_.resize(word.size() + 1);
+		}
+		tries_[word.size()].words.push_back(word);
+	}
+	for (auto length = std::size_t{1}; length < tries_.size(); ++length) {
+		auto& words_trie = tries_[length];
+		std::sort(words_trie.words.begin(), words_trie.words.end());
+		words_trie.letters.resize(length);
+		words_trie.first_child.resize(length);
+		words_trie.first_child.front().push_back(0);
+		auto previous = std::string_view{};
+		for (auto const& word : words_trie.words) {
+			auto const common = static_cast<std::size_t>(
+			    std::mismatch(word.begin(), word.end(), previous.begin(), previous.end()).first - word.begin());
+			for (auto depth = common; depth < length; ++depth) {
+				words_trie.letters[depth].push_back(word[depth]);
+				if (depth + 1 < length) {
+					words_trie.first_child[depth + 1].push_back(
+					    static_cast<std::uint32_t>(words_trie.letters[depth + 1].size()));
+				}
+			}
+			previous = word;
+		}
+		for (auto depth = std::size_t{0}; depth < length; ++depth) {
+			words_trie.first_child[depth].push_back(static_cast<std::uint32_t>(words_trie.letters[depth].size()));
+		}
+	}
+}
+
+auto word_ladder::neighbour_trie::words_of_length(std::size_t length) const -> std::span<const std::string> {
+	if (length >= tries_.size()) {
+		return {};
+	}
+	return tries_[length].words;
+}
+
+/**
+ * @brief depth-first walk of the children of a node whose prefix matches the word. The child with the
+ * word's own letter keeps the match going; any other child spends the one substitution, so below it
+ * only the word's letters are followed, down a single path, and the walk ends at the first letter no
+ * word has there
+ *
+ * @param words_trie - the trie of the word's length
+ * @param word - the word to find the neighbours of
+ * @param depth - the level of node, which is the length of its prefix
+ * @param node - a node whose prefix is the word's first depth letters
+ * @param out - where the indexes of the neighbours are added, ascending
+ */
+auto word_ladder::neighbour_trie::walk(const trie& words_trie,
+                                       std::string_view word,
+                                       std::size_t depth,
+                                       std::uint32_t node,
+                                       std::vector<std::uint32_t>& out) -> void {
+	auto const& letters = words_trie.letters;
+	auto const& first_child = words_trie.first_child;
+	for (auto child = first_child[depth][node]; child < first_child[depth][node + 1]; ++child) {
+		if (letters[depth][child] == word[depth]) {
+			if (depth + 1 < word.size()) {
+				walk(words_trie, word, depth + 1, child, out);
+			}
+			continue;
+		}
+		auto match = child;
+		auto level = depth + 1;
+		for (; level < word.size(); ++level) {
+			auto next = first_child[level][match];
+			auto const end = first_child[level][match + 1];
+			while (next < end and letters[level][next] < word[level]) {
+				++next;
+			}
+			if (next == end or letters[level][next] != word[level]) {
+				break;
+			}
+			match = next;
+		}
+		if (level == word.size()) {
+			out.push_back(match);
+		}
+	}
+}
+
+auto word_ladder::neighbour_trie::neighbour_indexes(std::string_view word) const -> std::vector<std::uint32_t> {
+	auto indexes = std::vector<std::uint32_t>{};
+	if (word.empty() or word.size() >= tries_.size() or tries_[word.size()].words.empty()) {
+		return indexes;
+	}
+	walk(tries_[word.size()], word, 0, 0, indexes);
+	return indexes;
+}
+
+auto word_ladder::neighbour_trie::neighbours(std::string_view word) const -> std::vector<std::string> {
+	auto const words = words_of_length(word.size());
+	auto adjacent_words = std::vector<std::string>{};
+	for (auto const index : neighbour_indexes(word)) {
+		adjacent_words.push_back(words[index]);
+	}
+	return adjacent_words;
+}
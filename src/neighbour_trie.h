@@ -0,0 +1,51 @@
+#ifndef COMP6771_NEIGHBOUR_TRIE_H
+#define COMP6771_NEIGHBOUR_TRIE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// Finds neighbours by walking a trie of the words of the query's length, instead of trying every
+	// letter at every position. The walk follows the query's letters and may take one other letter on
+	// the way; after that only the query's own letters are followed, so a prefix that already differs
+	// from the query twice is never visited. Letters that no word has at a position, given the prefix
+	// before it, are never tried at all.
+	class neighbour_trie {
+	public:
+		explicit neighbour_trie(const std::unordered_set<std::string>& lexicon);
+
+		// The words of one length, in alphabetical order.
+		auto words_of_length(std::size_t length) const -> std::span<const std::string>;
+		// Every word that differs from word in exactly one letter, in alphabetical order.
+		auto neighbours(std::string_view word) const -> std::vector<std::string>;
+		// Same as neighbours, as indexes into words_of_length(word.size()).
+		auto neighbour_indexes(std::string_view word) const -> std::vector<std::uint32_t>;
+
+	private:
+		// The trie of the words of one length, level by level. The nodes of level d are the distinct
+		// prefixes of d letters, in alphabetical order, so the children of a node are a contiguous run
+		// of the next level and the leaves are the words themselves, numbered as in words.
+		struct trie {
+			std::vector<std::string> words;
+			// letters[d][n] is the last letter of node n of level d + 1
+			std::vector<std::vector<char>> letters;
+			// the children of node n of level d are first_child[d][n] up to first_child[d][n + 1]
+			std::vector<std::vector<std::uint32_t>> first_child;
+		};
+
+		static auto walk(const trie& words_trie,
+		                 std::string_view word,
+		                 std::size_t depth,
+		                 std::uint32_t node,
+		                 std::vector<std::uint32_t>& out) -> void;
+
+		std::vector<trie> tries_;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_NEIGHBOUR_TRIE_H
@@ -0,0 +1,75 @@
+#include "neighbour_trie.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/**
+ * @brief testing helper function to find neighbours the slow, obvious way
+ *
+ * @param word - the word to find the neighbours of
+ * @param lexicon - the dictionary
+ * @return std::vector<std::string> - every word one letter different from word, in alphabetical order
+ */
+auto substitution_neighbours(const std::string& word, const std::unordered_set<std::string>& lexicon)
+    -> std::vector<std::string> {
+	auto neighbours = std::vector<std::string>{};
+	auto candidate = word;
+	for (auto i = std::size_t{0}; i < word.size(); ++i) {
+		for (auto c = 'a'; c <= 'z'; ++c) {
+			if (c == word[i]) {
+				continue;
+			}
+			candidate[i] = c;
+			if (lexicon.contains(candidate)) {
+				neighbours.push_back(candidate);
+			}
+		}
+		candidate[i] = word[i];
+	}
+	std::sort(neighbours.begin(), neighbours.end());
+	return neighbours;
+}
+
+TEST_CASE("trie walk finds exactly the one-letter neighbours") {
+	auto const lexicon = std::unordered_set<std::string>{"cat", "cot", "cut", "cog", "dot", "at", "cats", "bat"};
+	auto const trie = ::word_ladder::neighbour_trie(lexicon);
+	CHECK(trie.words_of_length(3).size() == 6);
+	CHECK(trie.neighbours("cot") == std::vector<std::string>{"cat", "cog", "cut", "dot"});
+	CHECK(trie.neighbours("cat") == std::vector<std::string>{"bat", "cot", "cut"});
+	CHECK(trie.neighbour_indexes("cat") == std::vector<std::uint32_t>{0, 3, 4});
+	CHECK(trie.neighbours("it") == std::vector<std::string>{"at"});
+	CHECK(trie.neighbours("cats").empty());
+
+	// words outside the lexicon and lengths it does not have
+	CHECK(trie.neighbours("cxt") == std::vector<std::string>{"cat", "cot", "cut"});
+	CHECK(trie.neighbours("zzz").empty());
+	CHECK(trie.neighbours("a").empty());
+	CHECK(trie.neighbours("").empty());
+	CHECK(trie.neighbours("catsup").empty());
+
+	auto const empty = ::word_ladder::neighbour_trie({});
+	CHECK(empty.words_of_length(3).empty());
+	CHECK(empty.neighbours("cat").empty());
+}
+
+TEST_CASE("trie walk matches substitution on english") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const trie = ::word_ladder::neighbour_trie(lexicon);
+
+	for (auto const* word : {"a", "at", "cat", "work", "sleep", "dinner", "walking", "peppiest", "derailing"}) {
+		CHECK(trie.neighbours(word) == substitution_neighbours(word, lexicon));
+	}
+	for (auto length = std::size_t{1}; length <= 29; ++length) {
+		auto const words = trie.words_of_length(length);
+		for (auto i = std::size_t{0}; i < words.size(); i += 97) {
+			CHECK(trie.neighbours(words[i]) == substitution_neighbours(words[i], lexicon));
+		}
+		if (not words.empty()) {
+			CHECK(trie.neighbours(words.back()) == substitution_neighbours(words.back(), lexicon));
+		}
+	}
+}
@@ -0,0 +1,54 @@
+#include "parallel_for.h"
+// data structures
+#include <thread>
+#include <vector>
+// other functionality
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+
+auto word_ladder::default_thread_count() -> std::size_t {
+	return std::max(std::size_t{std::thread::hardware_concurrency()}, std::size_t{1});
+}
+
+/**
+ * @brief run count tasks on a pool of threads that take the next index from a shared counter until
+ * none are left. A task that throws does not stop the others; its exception is kept and rethrown once
+ * every thread has been joined
+ *
+ * @param count - the number of tasks
+ * @param thread_count - the most threads to run them on, including the calling thread
+ * @param task - the work for one index
+ */
+auto word_ladder::parallel_for(std::size_t count,
+                               std::size_t thread_count,
+                               const std::function<void(std::size_t)>& task) -> void {
+	auto next = std::atomic<std::size_t>{0};
+	auto failure = std::exception_ptr{};
+	auto failure_mutex = std::mutex{};
+	auto const work = [&] {
+		for (auto index = next.fetch_add(1); index < count; index = next.fetch_add(1)) {
+			try {
+				task(index);
+			} catch (...) {
+				auto const lock = std::scoped_lock(failure_mutex);
+				if (not failure) {
+					failure = std::current_exception();
+				}
+			}
+		}
+	};
+
+	auto const helpers = std::min(thread_count, count) > 1 ? std::min(thread_count, count) - 1 : 0;
+	auto threads = std::vector<std::jthread>{};
+	threads.reserve(helpers);
+	for (auto i = std::size_t{0}; i < helpers; ++i) {
+		threads.emplace_back(work);
+	}
+	work();
+	threads.clear();
+	if (failure) {
+		std::rethrow_exception(failure);
+	}
+}
@@ -0,0 +1,18 @@
+#ifndef COMP6771_PARALLEL_FOR_H
+#define COMP6771_PARALLEL_FOR_H
+
+#include <cstddef>
+#include <functional>
+
+namespace word_ladder {
+	// The number of threads to use when the caller does not say: one per hardware thread.
+	auto default_thread_count() -> std::size_t;
+
+	// Runs task(i) for every i in [0, count) on up to thread_count threads, the calling thread being
+	// one of them. Indexes are handed out one at a time, so a few slow tasks do not hold up the rest.
+	// Returns once every task has finished; if any task throws, the first exception is rethrown then.
+	auto parallel_for(std::size_t count, std::size_t thread_count, const std::function<void(std::size_t)>& task)
+	    -> void;
+} // namespace word_ladder
+
+#endif // COMP6771_PARALLEL_FOR_H
@@ -0,0 +1,35 @@
+#include "parallel_for.h"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("parallel_for runs every index exactly once") {
+	for (auto const thread_count : {std::size_t{1}, std::size_t{3}, std::size_t{16}}) {
+		auto runs = std::vector<std::atomic<int>>(100);
+		::word_ladder::parallel_for(runs.size(), thread_count, [&](std::size_t i) { ++runs[i]; });
+		for (auto const& count : runs) {
+			CHECK(count == 1);
+		}
+	}
+	auto ran = false;
+	::word_ladder::parallel_for(0, 4, [&](std::size_t) { ran = true; });
+	CHECK_FALSE(ran);
+	CHECK(::word_ladder::default_thread_count() >= 1);
+}
+
+TEST_CASE("parallel_for finishes the other tasks and rethrows a task's exception") {
+	auto done = std::atomic<int>{0};
+	CHECK_THROWS_AS(::word_ladder::parallel_for(20,
+	                                            4,
+	                                            [&](std::size_t i) {
+		                                            if (i == 7) {
+			                                            throw std::runtime_error("task failed");
+		                                            }
+		                                            ++done;
+	                                            }),
+	                std::runtime_error);
+	CHECK(done == 19);
+}
@@ -0,0 +1,155 @@
+#include "parallel_loader.h"
+#include "lexicon_graph.h"
+#include "line_tokenizer.h"
+#include "parallel_for.h"
+// data structures
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+// file reading
+#include <fstream>
+// other functionality
+#include <algorithm>
+
+namespace {
+	// chunks smaller than this are not worth a task of their own
+	constexpr auto min_chunk_size = std::size_t{1} << 16;
+	// more chunks than threads, so that threads that finish early can take another
+	constexpr auto chunks_per_thread = std::size_t{4};
+	// sets of fewer words than this are not worth filling on a thread of their own
+	constexpr auto min_shard_size = std::size_t{1} << 14;
+
+	/**
+	 * @brief reads a whole file into memory
+	 *
+	 * @param path - the file to read
+	 * @return std::vector<char> - its contents, or nothing if it cannot be read
+	 */
+	auto read_file(const std::string& path) -> std::vector<char> {
+		auto file_stream = std::ifstream(path, std::ios::binary | std::ios::ate);
+		if (not file_stream.is_open()) {
+			return {};
+		}
+		auto buffer = std::vector<char>(static_cast<std::size_t>(file_stream.tellg()));
+		file_stream.seekg(0);
+		file_stream.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+		buffer.resize(static_cast<std::size_t>(file_stream.gcount()));
+		return buffer;
+	}
+
+	/**
+	 * @brief finds where chunk i of n starts: the nominal offset i * size / n moved forward to just past
+	 * the next newline, so no line is split between chunks
+	 *
+	 * @param text - the whole file
+	 * @param i - the chunk
+	 * @param n - the number of chunks
+	 * @return std::size_t - the offset of the chunk's first line
+	 */
+	auto chunk_start(std::string_view text, std::size_t i, std::size_t n) -> std::size_t {
+		if (i == 0) {
+			return 0;
+		}
+		if (i == n) {
+			return text.size();
+		}
+		auto const newline = text.find('\n', text.size() / n * i - 1);
+		return newline == std::string_view::npos ? text.size() : newline + 1;
+	}
+
+	/**
+	 * @brief splits a chunk into words and groups them by length
+	 *
+	 * @param chunk - whole lines of the file
+	 * @return std::vector<std::vector<std::string_view>> - the words of each length
+	 */
+	auto parse_chunk(std::string_view chunk) -> std::vector<std::vector<std::string_view>> {
+		auto words = std::vector<std::string_view>{};
+		word_ladder::tokenize_words(chunk, words);
+		auto by_length = std::vector<std::vector<std::string_view>>{};
+		for (auto const word : words) {
+			if (word.size() >= by_length.size()) {
+				by_length.resize(word.size() + 1);
+			}
+			by_length[word.size()].push_back(word);
+		}
+		return by_length;
+	}
+} // namespace
+
+/**
+ * @brief load a word list into one buffer and parse it in parallel, merging the chunks by length
+ *
+ * @param path - file path of the lexicon
+ * @param thread_count - the most threads to parse with
+ * @return loaded_lexicon - the buffer and the sorted, unique words in it
+ */
+auto word_ladder::load_lexicon_words(const std::string& path, std::size_t thread_count) -> loaded_lexicon {
+	auto lexicon = loaded_lexicon{read_file(path), {}};
+	auto const text = std::string_view(lexicon.buffer.data(), lexicon.buffer.size());
+	thread_count = std::max<std::size_t>(thread_count, 1);
+	auto const chunk_count = std::clamp(text.size() / min_chunk_size, std::size_t{1}, thread_count * chunks_per_thread);
+
+	auto chunks = std::vector<std::vector<std::vector<std::string_view>>>(chunk_count);
+	parallel_for(chunk_count, thread_count, [&](std::size_t i) {
+		auto const start = chunk_start(text, i, chunk_count);
+		chunks[i] = parse_chunk(text.substr(start, chunk_start(text, i + 1, chunk_count) - start));
+	});
+
+	auto max_length = std::size_t{0};
+	for (auto const& chunk : chunks) {
+		max_length = std::max(max_length, chunk.size());
+	}
+	auto by_length = std::vector<std::vector<std::string_view>>(max_length);
+	parallel_for(max_length, thread_count, [&](std::size_t length) {
+		auto& words = by_length[length];
+		for (auto const& chunk : chunks) {
+			if (length < chunk.size()) {
+				words.insert(words.end(), chunk[length].begin(), chunk[length].end());
+			}
+		}
+		std::sort(words.begin(), words.end());
+		words.erase(std::unique(words.begin(), words.end()), words.end());
+	});
+	for (auto const& words : by_length) {
+		lexicon.words.insert(lexicon.words.end(), words.begin(), words.end());
+	}
+	return lexicon;
+}
+
+/**
+ * @brief load a word list in parallel and copy the words into a hash set. The copies are made on
+ * every thread, each thread filling a set of its own from one range of the words; the sets are then
+ * spliced into the first, which was sized for every word. Splicing moves the nodes rather than the
+ * strings, so only the linking is left to one thread
+ *
+ * @param path - file path of the lexicon
+ * @param thread_count - the most threads to parse and copy with
+ * @return std::unordered_set<std::string> - the words
+ */
+auto word_ladder::read_lexicon(const std::string& path, std::size_t thread_count) -> std::unordered_set<std::string> {
+	auto const loaded = load_lexicon_words(path, thread_count);
+	auto const word_count = loaded.words.size();
+	auto const shard_count =
+	    std::clamp(word_count / min_shard_size, std::size_t{1}, std::max<std::size_t>(thread_count, 1));
+	auto shards = std::vector<std::unordered_set<std::string>>(shard_count);
+	parallel_for(shard_count, thread_count, [&](std::size_t i) {
+		auto const begin = word_count * i / shard_count;
+		auto const end = word_count * (i + 1) / shard_count;
+		shards[i].reserve(i == 0 ? word_count : end - begin);
+		for (auto j = begin; j < end; ++j) {
+			shards[i].emplace(loaded.words[j]);
+		}
+	});
+	auto lexicon = std::move(shards.front());
+	for (auto i = std::size_t{1}; i < shard_count; ++i) {
+		lexicon.merge(shards[i]);
+	}
+	return lexicon;
+}
+
+auto word_ladder::load_graph_image(const std::string& path, std::size_t thread_count) -> std::vector<std::byte> {
+	auto const loaded = load_lexicon_words(path, thread_count);
+	return build_graph_image(loaded.words, thread_count);
+}
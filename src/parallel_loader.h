@@ -0,0 +1,34 @@
+#ifndef COMP6771_PARALLEL_LOADER_H
+#define COMP6771_PARALLEL_LOADER_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace word_ladder {
+	// The words of a lexicon file, as views into one buffer holding the whole file.
+	struct loaded_lexicon {
+		std::vector<char> buffer;
+		// Sorted by length and then alphabetically, without duplicates: the order of graph ids.
+		std::vector<std::string_view> words;
+	};
+
+	// Reads a newline-separated word list in one go and parses it on up to thread_count threads. The
+	// buffer is cut into chunks at newlines and every chunk is split into lines and grouped by length
+	// on its own; then each length gathers its words from every chunk, sorts them and drops repeats,
+	// again one task per length. The result does not depend on the thread count or chunking. Lines are
+	// split by tokenize_words, as read_lexicon splits them; a file that cannot be read gives no words.
+	auto load_lexicon_words(const std::string& path, std::size_t thread_count) -> loaded_lexicon;
+
+	// Same words as read_lexicon, parsed in parallel by load_lexicon_words. The set is filled in parallel
+	// too, as one set per thread that are then spliced together.
+	auto read_lexicon(const std::string& path, std::size_t thread_count) -> std::unordered_set<std::string>;
+
+	// Loads a word list and builds its graph image, with both the parsing and the graph construction
+	// spread over up to thread_count threads. Same image as build_graph_image of read_lexicon(path).
+	auto load_graph_image(const std::string& path, std::size_t thread_count) -> std::vector<std::byte>;
+} // namespace word_ladder
+
+#endif // COMP6771_PARALLEL_LOADER_H
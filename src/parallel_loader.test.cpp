@@ -0,0 +1,56 @@
+#include "parallel_loader.h"
+#include "lexicon_graph.h"
+#include "word_ladder.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+TEST_CASE("parallel loading reads the same words as read_lexicon") {
+	auto const expected = ::word_ladder::read_lexicon("./english.txt");
+	for (auto const thread_count : {std::size_t{1}, std::size_t{4}}) {
+		auto const loaded = ::word_ladder::load_lexicon_words("./english.txt", thread_count);
+		CHECK(loaded.words.size() == expected.size());
+		CHECK(std::is_sorted(loaded.words.begin(), loaded.words.end(), [](auto a, auto b) {
+			return a.size() != b.size() ? a.size() < b.size() : a < b;
+		}));
+		CHECK(::word_ladder::read_lexicon("./english.txt", thread_count) == expected);
+	}
+	// no threads is taken as one
+	CHECK(::word_ladder::load_lexicon_words("./english.txt", 0).words.size() == expected.size());
+	CHECK(::word_ladder::load_lexicon_words("./no_such_file.txt", 4).words.empty());
+}
+
+TEST_CASE("chunks are cut at newlines and merged without repeats") {
+	// several chunks' worth of lines, with repeats across chunks, empty lines and no final newline
+	auto const path = std::string("./parallel_loader_test.txt");
+	auto expected = std::unordered_set<std::string>{};
+	{
+		auto file_stream = std::ofstream(path, std::ios::binary | std::ios::trunc);
+		for (auto i = 0; i < 60000; ++i) {
+			auto word = std::string{};
+			for (auto n = i % 9000 + 1; n > 0; n /= 26) {
+				word += static_cast<char>('a' + n % 26);
+			}
+			expected.insert(word);
+			file_stream << word << (i % 1000 == 0 ? "\n\n" : "\n");
+		}
+		file_stream << "last";
+		expected.insert("last");
+	}
+	for (auto const thread_count : {std::size_t{1}, std::size_t{3}, std::size_t{8}}) {
+		CHECK(::word_ladder::read_lexicon(path, thread_count) == expected);
+	}
+	std::remove(path.c_str());
+}
+
+TEST_CASE("parallel graph construction builds the same image for any thread count") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const expected = ::word_ladder::build_graph_image(lexicon);
+	CHECK(::word_ladder::build_graph_image(lexicon, 4) == expected);
+	CHECK(::word_ladder::load_graph_image("./english.txt", 1) == expected);
+	CHECK(::word_ladder::load_graph_image("./english.txt", 4) == expected);
+}
@@ -0,0 +1,55 @@
+#include "visited_bitmap.h"
+
+#include <algorithm>
+
+/**
+ * @brief start a new epoch, which makes every block written in an older one read as zero. Only when the
+ * 32-bit epoch counter wraps around are the stamps actually cleared
+ *
+ * @param bit_count - the number of bits the bitmap must hold from now on
+ */
+auto word_ladder::visited_bitmap::reset(std::size_t bit_count) -> void {
+	block_count_ = (bit_count + 63) / 64;
+	if (block_count_ > bits_.size()) {
+		bits_.resize(block_count_, 0);
+		epochs_.resize(block_count_, 0);
+	}
+	++epoch_;
+	if (epoch_ == 0) {
+		std::fill(epochs_.begin(), epochs_.end(), 0);
+		epoch_ = 1;
+	}
+}
+
+/**
+ * @brief or another bitmap into this one. Blocks that are zero in the other bitmap are skipped, so
+ * merging a sparse search level only touches the blocks it set
+ *
+ * @param other - the bitmap to merge, of the same size
+ */
+auto word_ladder::visited_bitmap::merge(const visited_bitmap& other) -> void {
+	auto const count = std::min(block_count_, other.block_count_);
+	for (auto index = std::size_t{0}; index < count; ++index) {
+		auto const bits = other.block(index);
+		if (bits != 0) {
+			touch(index) |= bits;
+		}
+	}
+}
+
+/**
+ * @brief start a new epoch, which makes every distance written in an older one read as unset. As for
+ * the bitmap, the stamps are only cleared when the epoch counter wraps around
+ *
+ * @param count - the number of distances the array must hold from now on
+ */
+auto word_ladder::stamped_distances::reset(std::size_t count) -> void {
+	if (count > entries_.size()) {
+		entries_.resize(count);
+	}
+	++epoch_;
+	if (epoch_ == 0) {
+		std::fill(entries_.begin(), entries_.end(), entry{});
+		epoch_ = 1;
+	}
+}
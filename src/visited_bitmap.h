@@ -0,0 +1,81 @@
+#ifndef COMP6771_VISITED_BITMAP_H
+#define COMP6771_VISITED_BITMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace word_ladder {
+	// One bit per word id, for the visited sets of an id-based search. Every 64-bit block carries the
+	// epoch it was last written in, and a block from an older epoch reads as zero, so reset() forgets
+	// every bit by bumping the epoch instead of clearing memory. A bitmap kept per thread can then
+	// serve query after query without paying for a memset each time.
+	class visited_bitmap {
+	public:
+		// Forgets every bit and makes room for bit_count bits. Constant time unless the bitmap grows.
+		auto reset(std::size_t bit_count) -> void;
+
+		auto test(std::size_t bit) const -> bool {
+			return (block(bit / 64) >> (bit % 64) & 1) != 0;
+		}
+		// Returns true if the bit was clear.
+		auto set(std::size_t bit) -> bool {
+			auto& bits = touch(bit / 64);
+			auto const mask = std::uint64_t{1} << (bit % 64);
+			auto const was_clear = (bits & mask) == 0;
+			bits |= mask;
+			return was_clear;
+		}
+		// Sets every bit that is set in other, one 64-bit block at a time.
+		auto merge(const visited_bitmap& other) -> void;
+
+	private:
+		auto block(std::size_t index) const -> std::uint64_t {
+			return epochs_[index] == epoch_ ? bits_[index] : 0;
+		}
+		auto touch(std::size_t index) -> std::uint64_t& {
+			if (epochs_[index] != epoch_) {
+				epochs_[index] = epoch_;
+				bits_[index] = 0;
+			}
+			return bits_[index];
+		}
+
+		std::vector<std::uint64_t> bits_;
+		std::vector<std::uint32_t> epochs_;
+		std::uint32_t epoch_ = 0;
+		std::size_t block_count_ = 0;
+	};
+
+	// One distance per word id, stamped like visited_bitmap's blocks: an entry written in an older
+	// epoch reads as unset, so reset() forgets every distance without refilling the array. unset is
+	// the searches' unreached value, so it can be handed to label_distances as is.
+	class stamped_distances {
+	public:
+		static constexpr auto unset = std::numeric_limits<std::uint32_t>::max();
+
+		// Forgets every distance and makes room for count of them. Constant time unless it grows.
+		auto reset(std::size_t count) -> void;
+
+		auto operator[](std::size_t id) -> std::uint32_t& {
+			auto& entry = entries_[id];
+			if (entry.epoch != epoch_) {
+				entry.epoch = epoch_;
+				entry.distance = unset;
+			}
+			return entry.distance;
+		}
+
+	private:
+		struct entry {
+			std::uint32_t epoch = 0;
+			std::uint32_t distance = unset;
+		};
+
+		std::vector<entry> entries_;
+		std::uint32_t epoch_ = 0;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_VISITED_BITMAP_H
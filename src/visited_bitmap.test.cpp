@@ -0,0 +1,77 @@
+#include "visited_bitmap.h"
+
+#include <catch2/catch.hpp>
+
+TEST_CASE("visited bitmap sets and tests bits") {
+	auto bitmap = ::word_ladder::visited_bitmap{};
+	bitmap.reset(200);
+	CHECK_FALSE(bitmap.test(0));
+	CHECK(bitmap.set(0));
+	CHECK(bitmap.set(63));
+	CHECK(bitmap.set(64));
+	CHECK(bitmap.set(199));
+	CHECK_FALSE(bitmap.set(63));
+	CHECK(bitmap.test(0));
+	CHECK(bitmap.test(63));
+	CHECK(bitmap.test(64));
+	CHECK(bitmap.test(199));
+	CHECK_FALSE(bitmap.test(1));
+	CHECK_FALSE(bitmap.test(128));
+}
+
+TEST_CASE("visited bitmap reset forgets every bit") {
+	auto bitmap = ::word_ladder::visited_bitmap{};
+	bitmap.reset(100);
+	bitmap.set(5);
+	bitmap.set(70);
+	bitmap.reset(100);
+	CHECK_FALSE(bitmap.test(5));
+	CHECK_FALSE(bitmap.test(70));
+	CHECK(bitmap.set(70));
+
+	// growing keeps the old blocks forgotten and the new ones clear
+	bitmap.reset(1000);
+	CHECK_FALSE(bitmap.test(70));
+	CHECK_FALSE(bitmap.test(999));
+	CHECK(bitmap.set(999));
+}
+
+TEST_CASE("visited bitmap merge ors the other bitmap in") {
+	auto visited = ::word_ladder::visited_bitmap{};
+	auto level = ::word_ladder::visited_bitmap{};
+	visited.reset(300);
+	level.reset(300);
+	visited.set(1);
+	level.set(2);
+	level.set(250);
+	visited.merge(level);
+	CHECK(visited.test(1));
+	CHECK(visited.test(2));
+	CHECK(visited.test(250));
+
+	level.reset(300);
+	level.set(3);
+	visited.merge(level);
+	CHECK(visited.test(3));
+	CHECK(visited.test(250));
+	CHECK_FALSE(level.test(250));
+}
+
+TEST_CASE("stamped distances read as unset after a reset") {
+	auto distances = ::word_ladder::stamped_distances{};
+	distances.reset(10);
+	CHECK(distances[3] == ::word_ladder::stamped_distances::unset);
+	distances[3] = 2;
+	distances[9] = 0;
+	CHECK(distances[3] == 2);
+	CHECK(distances[9] == 0);
+	distances.reset(10);
+	CHECK(distances[3] == ::word_ladder::stamped_distances::unset);
+	CHECK(distances[9] == ::word_ladder::stamped_distances::unset);
+
+	// growing keeps the old distances forgotten and the new ones unset
+	distances[4] = 1;
+	distances.reset(100);
+	CHECK(distances[4] == ::word_ladder::stamped_distances::unset);
+	CHECK(distances[99] == ::word_ladder::stamped_distances::unset);
+}
@@ -1,14 +1,23 @@
 #include "word_ladder.h"
+#include "line_tokenizer.h"
+#include "neighbour_provider.h"
 // data structures
+#include <unordered_map>
 #include <unordered_set>
 #include <queue>
 #include <string>
+#include <string_view>
 #include <vector>
 // file reading
 #include <fstream>
 #include <iostream>
 // other functionality
 #include <algorithm>
+#include <functional>
+#include <chrono>
+#include <limits>
+#include <stop_token>
+#include <tuple>
 
 // helper functions
 
@@ -53,6 +62,220 @@ auto find_words(std::string& word, const std::unordered_set<std::string>& lexico
 	// alphabetical is another way of saying ascending order
 	return adjacent_legal_words;
 }
+/**
+ * @brief helper function to count the letters two words of the same length differ in. Each rung of a
+ * ladder changes one letter, so this is a lower bound on the number of rungs between the two words
+ *
+ * @param word1 - the first word
+ * @param word2 - the second word
+ * @return std::size_t - the number of positions the words differ at
+ */
+auto hamming_distance(const std::string& word1, const std::string& word2) -> std::size_t {
+	auto distance = std::size_t{0};
+	for (auto i = std::size_t{0}; i < word1.size(); ++i) {
+		if (word1[i] != word2[i]) {
+			++distance;
+		}
+	}
+	return distance;
+}
+/**
+ * @brief helper function to build every ladder ending at a word by following the recorded parents
+ * back to the start word, which is the only word without parents
+ *
+ * @param word - the word to walk back from
+ * @param parents - for each reached word, the words one rung before it on a shortest ladder
+ * @param reversed_path - the ladder so far, from the destination back to word
+ * @param paths - where the finished ladders are added
+ */
+auto collect_paths(const std::string& word,
+                   const std::unordered_map<std::string, std::vector<std::string>>& parents,
+                   std::vector<std::string>& reversed_path,
+                   std::vector<std::vector<std::string>>& paths) -> void {
+	reversed_path.push_back(word);
+	auto const previous = parents.find(word);
+	if (previous == parents.end() or previous->second.empty()) {
+		paths.emplace_back(reversed_path.rbegin(), reversed_path.rend());
+	}
+	else {
+		for (auto const& parent : previous->second) {
+			collect_paths(parent, parents, reversed_path, paths);
+		}
+	}
+	reversed_path.pop_back();
+}
+/**
+ * @brief helper class to decide when an interruptible search has to give up, either because it was
+ * cancelled or because its deadline passed. Reading the clock for every word would cost about as much
+ * as expanding it, so within a level the clock is only read every check_interval words; level
+ * boundaries always read it
+ */
+class search_budget {
+public:
+	search_budget() = default;
+	search_budget(std::stop_token stop, std::chrono::steady_clock::time_point deadline)
+	: stop_(std::move(stop))
+	, deadline_(deadline) {}
+
+	// checked for every word expanded
+	auto exhausted() -> bool {
+		if (status_ != word_ladder::search_status::complete) {
+			return true;
+		}
+		if (++since_check_ < check_interval) {
+			return false;
+		}
+		return exhausted_now();
+	}
+	// checked at level boundaries
+	auto exhausted_now() -> bool {
+		since_check_ = 0;
+		if (status_ == word_ladder::search_status::complete) {
+			if (stop_.stop_requested()) {
+				status_ = word_ladder::search_status::cancelled;
+			}
+			else if (deadline_ != std::chrono::steady_clock::time_point::max()
+			         and std::chrono::steady_clock::now() >= deadline_) {
+				status_ = word_ladder::search_status::timed_out;
+			}
+		}
+		return status_ != word_ladder::search_status::complete;
+	}
+	auto status() const -> word_ladder::search_status {
+		return status_;
+	}
+
+private:
+	static constexpr auto check_interval = std::size_t{64};
+
+	std::stop_token stop_;
+	std::chrono::steady_clock::time_point deadline_ = std::chrono::steady_clock::time_point::max();
+	std::size_t since_check_ = 0;
+	word_ladder::search_status status_ = word_ladder::search_status::complete;
+};
+/**
+ * @brief helper class numbering the words one search reaches, in the order it reaches them, so a
+ * search pays only for the words it visits instead of numbering every word of the length first. The
+ * words are viewed in the lexicon, whose nodes never move, so it must outlive the numbering
+ */
+class discovered_words {
+public:
+	explicit discovered_words(const std::unordered_set<std::string>& lexicon)
+	: lexicon_(lexicon) {}
+
+	// the number of a word of the lexicon, numbering it first if the search has not met it yet
+	auto number(const std::string& word) -> std::uint32_t {
+		auto const [found, inserted] = numbers_.try_emplace(&word, static_cast<std::uint32_t>(words_.size()));
+		if (inserted) {
+			words_.push_back(&word);
+			distances.push_back(word_ladder::detail::unreached);
+		}
+		return found->second;
+	}
+	auto word(std::uint32_t id) const -> const std::string& {
+		return *words_[id];
+	}
+	// the numbers of the words one letter different, found by substituting every letter as find_words
+	// does
+	auto neighbours(std::uint32_t id) -> std::vector<std::uint32_t> {
+		auto candidate = word(id);
+		auto found = std::vector<std::uint32_t>{};
+		for (auto& letter : candidate) {
+			auto const original = letter;
+			for (auto substitute = 'a'; substitute <= 'z'; ++substitute) {
+				if (substitute == original) {
+					continue;
+				}
+				letter = substitute;
+				if (auto const match = lexicon_.find(candidate); match != lexicon_.end()) {
+					found.push_back(number(*match));
+				}
+			}
+			letter = original;
+		}
+		return found;
+	}
+
+	// each numbered word's distance to the target, grown as words are numbered
+	std::vector<std::uint32_t> distances;
+
+private:
+	const std::unordered_set<std::string>& lexicon_;
+	// keyed by where the word is in the lexicon, which is cheaper to hash than the word
+	std::unordered_map<const std::string*, std::uint32_t> numbers_;
+	std::vector<const std::string*> words_;
+};
+/**
+ * @brief helper function for the search every generate overload shares. A breadth-first search
+ * backward from the target labels each word with its distance to it, stopping after the level the
+ * start word is on; then the walk forward from the start word only ever steps one rung closer. Words
+ * are numbered as they are reached, so no work is done for words the search never meets
+ *
+ * @param from - the start word
+ * @param to - the target word
+ * @param lexicon - the dictionary of all legal words
+ * @param paths - where the ladders are added, in alphabetical order
+ * @param limit - the most ladders wanted
+ * @param budget - when to give up; the ladders found so far are kept if it runs out
+ */
+auto search_two_phase(const std::string& from,
+                      const std::string& to,
+                      const std::unordered_set<std::string>& lexicon,
+                      std::vector<std::vector<std::string>>& paths,
+                      std::size_t limit,
+                      search_budget& budget) -> void {
+	auto const start = lexicon.find(from);
+	auto const destination = lexicon.find(to);
+	if (start == lexicon.end() or destination == lexicon.end() or from.size() != to.size() or limit == 0) {
+		return;
+	}
+	auto words = discovered_words(lexicon);
+	auto const target = words.number(*destination);
+	auto const source = words.number(*start);
+	word_ladder::detail::label_distances(
+	    target,
+	    source,
+	    0,
+	    words.distances,
+	    [&](std::uint32_t number) { return words.neighbours(number); },
+	    budget);
+	if (words.distances[source] == word_ladder::detail::unreached or budget.exhausted_now()) {
+		return;
+	}
+
+	// each word on a ladder, with its neighbours one rung closer in alphabetical order
+	auto closer = std::unordered_map<std::uint32_t, std::vector<std::uint32_t>>{};
+	auto const neighbours = [&](std::uint32_t number) -> const std::vector<std::uint32_t>& {
+		auto [found, inserted] = closer.try_emplace(number);
+		if (inserted) {
+			auto const distance = words.distances[number] - 1;
+			for (auto const neighbour : words.neighbours(number)) {
+				if (words.distances[neighbour] == distance) {
+					found->second.push_back(neighbour);
+				}
+			}
+			std::ranges::sort(found->second, {}, [&](std::uint32_t id) -> const std::string& {
+				return words.word(id);
+			});
+		}
+		return found->second;
+	};
+	auto path = std::vector<std::uint32_t>{source};
+	word_ladder::detail::walk_closer(
+	    path,
+	    target,
+	    neighbours,
+	    [&](std::uint32_t number) { return words.distances[number]; },
+	    [&](const std::vector<std::uint32_t>& ladder) {
+		    auto& added = paths.emplace_back();
+		    added.reserve(ladder.size());
+		    for (auto const number : ladder) {
+			    added.push_back(words.word(number));
+		    }
+		    return paths.size() < limit;
+	    },
+	    budget);
+}
 /**
  * @brief read in a list of words to act as the dictionary for the word ladder generation
  *
@@ -61,21 +284,26 @@ auto find_words(std::string& word, const std::unordered_set<std::string>& lexico
  */
 auto word_ladder::read_lexicon(const std::string& path) -> std::unordered_set<std::string> {
 	auto lexicon = std::unordered_set<std::string>{};
-	std::fstream file_stream;
-	file_stream.open(path);
+	auto file_stream = std::ifstream(path, std::ios::binary | std::ios::ate);
 	if (file_stream.is_open()) {
-		std::string word = "";
-		while (getline(file_stream, word)) {
-			lexicon.insert(word);
+		auto text = std::string(static_cast<std::size_t>(file_stream.tellg()), '\0');
+		file_stream.seekg(0);
+		file_stream.read(text.data(), static_cast<std::streamsize>(text.size()));
+		text.resize(static_cast<std::size_t>(file_stream.gcount()));
+		auto words = std::vector<std::string_view>{};
+		tokenize_words(text, words);
+		lexicon.reserve(words.size());
+		for (auto const word : words) {
+			lexicon.emplace(word);
 		}
-		file_stream.close();
 	}
 	return lexicon;
 }
 
 /**
  * @brief function to generate the list of all shortest word ladders between a source and target word. Returns an empty
- * list if there are no solutions. If there are multiple solutions they are organsied in alphabetical order
+ * list if there are no solutions. If there are multiple solutions they are organsied in alphabetical order. The
+ * ladders are built in that order by the same walk as the limit overload, so they are never sorted
  *
  * @param from - the source word
  * @param to - the target word
@@ -85,52 +313,123 @@ auto word_ladder::read_lexicon(const std::string& path) -> std::unordered_set<st
  */
 auto word_ladder::generate(const std::string& from, const std::string& to, const std::unordered_set<std::string>& lexicon)
     -> std::vector<std::vector<std::string>> {
+	return generate(from, to, lexicon, std::numeric_limits<std::size_t>::max());
+}
+
+/**
+ * @brief function to generate the first shortest word ladders in alphabetical order. A breadth-first
+ * search backward from the target labels distances up to the start word's level, and a depth-first
+ * walk forward from the start word, only ever stepping one rung closer, then produces the ladders
+ * already sorted, stopping once it has limit of them. Only the words it walks through are expanded
+ * a second time
+ *
+ * @param from - the source word
+ * @param to - the target word
+ * @param lexicon - the supporting dictionary used to generate the ladder solution(s)
+ * @param limit - the most ladders to return
+ * @return std::vector<std::vector<std::string>> - up to limit solutions, in alphabetical order
+ */
+auto word_ladder::generate(const std::string& from,
+                           const std::string& to,
+                           const std::unordered_set<std::string>& lexicon,
+                           std::size_t limit) -> std::vector<std::vector<std::string>> {
 	auto shortest_paths = std::vector<std::vector<std::string>>{};
-	auto path = std::vector<std::string>{from}; // starting path
-	auto words = std::queue<std::vector<std::string>>{}; // queue for breadth-first search
-	auto visited_globally = std::unordered_set<std::string>{from};
+	if (limit == 0) {
+		return shortest_paths;
+	}
+	auto budget = search_budget{};
+	search_two_phase(from, to, lexicon, shortest_paths, limit, budget);
+	return shortest_paths;
+}
 
-	words.push(path);
-	while (not words.empty()) {
-		auto level = words.size();
-		auto visisted_at_level = std::unordered_set<std::string>{};
-		// processes current potential paths in batches such that they are the same length
-		// it optimises the algorithm, allowing for paths that will not lead to a solution to
-		// be dropped early in the algorithm
+/**
+ * @brief function to generate the shortest word ladders in alphabetical order, giving up early if asked
+ * to stop or if the deadline passes. This is the same search as the limit overload, with the budget
+ * checked at every level and periodically within one
+ *
+ * @param from - the source word
+ * @param to - the target word
+ * @param lexicon - the supporting dictionary used to generate the ladder solution(s)
+ * @param stop - the token a caller can request a stop through
+ * @param deadline - when to give up
+ * @return search_result - how the search ended, and the ladders it found
+ */
+auto word_ladder::generate(const std::string& from,
+                           const std::string& to,
+                           const std::unordered_set<std::string>& lexicon,
+                           std::stop_token stop,
+                           std::chrono::steady_clock::time_point deadline) -> search_result {
+	auto result = search_result{search_status::complete, {}};
+	auto budget = search_budget(std::move(stop), deadline);
+	search_two_phase(from, to, lexicon, result.ladders, std::numeric_limits<std::size_t>::max(), budget);
+	result.status = budget.status();
+	return result;
+}
 
-		// avoids redundant and length processing of paths that are already known to not be a solution
-		for (auto i = std::size_t{0}; i < level; ++i) {
-			auto current_path = words.front();
-			words.pop();
-			auto current_tail = *current_path.rbegin();
+/**
+ * @brief function to generate the list of all shortest word ladders with an A* search. Words come off the
+ * open list in order of rungs so far plus the hamming distance to the target, which never overestimates
+ * the rungs left. Once the target has been reached, any word whose estimate exceeds that length cannot
+ * be on a shortest ladder and is neither queued nor expanded. Every parent a word is reached from at its
+ * shortest depth is kept so that all shortest ladders can be rebuilt, not just the first one found
+ *
+ * @param from - the source word
+ * @param to - the target word
+ * @param lexicon - the supporting dictionary used to generate the ladder solution(s)
+ * @return std::vector<std::vector<std::string>> - the list of solutions, in alphabetical order
+ */
+auto word_ladder::generate_astar(const std::string& from,
+                                 const std::string& to,
+                                 const std::unordered_set<std::string>& lexicon)
+    -> std::vector<std::vector<std::string>> {
+	// (estimated ladder length, rungs so far, word); deeper words win ties as they are closer to the target
+	using entry = std::tuple<std::size_t, std::size_t, std::string>;
+	auto const later = [](const entry& a, const entry& b) {
+		return std::get<0>(a) != std::get<0>(b) ? std::get<0>(a) > std::get<0>(b) : std::get<1>(a) < std::get<1>(b);
+	};
+	auto open = std::priority_queue<entry, std::vector<entry>, decltype(later)>(later);
+	auto depth = std::unordered_map<std::string, std::size_t>{{from, 0}};
+	auto parents = std::unordered_map<std::string, std::vector<std::string>>{};
+	auto best = std::numeric_limits<std::size_t>::max();
 
-			// ignore potential solutions that are greater than the shortest oone
-			if (current_tail == to) {
-				if (shortest_paths.size() > 0) {
-					if (current_path.size() > (*shortest_paths.rbegin()).size()) {
-						break;
-					} // - a potential optimisation for when you can find multiple paths
-				}
-				shortest_paths.push_back(current_path);
+	open.emplace(hamming_distance(from, to), 0, from);
+	while (not open.empty()) {
+		auto [estimate, rungs, word] = open.top();
+		open.pop();
+		if (estimate > best) {
+			break;
+		}
+		if (rungs > depth[word]) {
+			continue; // a shorter way to this word was found after this entry was queued
+		}
+		if (word == to) {
+			best = rungs;
+			continue;
+		}
+		for (auto& adjacent_word : find_words(word, lexicon)) {
+			auto const adjacent_rungs = rungs + 1;
+			auto const adjacent_estimate = adjacent_rungs + hamming_distance(adjacent_word, to);
+			if (adjacent_estimate > best) {
 				continue;
-				;
 			}
-			// find next potential steps in the ladder, iterate through them, mark them and
-			// add a new path to the queue for traversal
-			auto adjacent_words = find_words(current_tail, lexicon);
-			for (auto i = std::size_t{0}; i < adjacent_words.size(); ++i) {
-				if (visited_globally.find(adjacent_words[i]) == visited_globally.end()) {
-					visisted_at_level.insert(adjacent_words[i]);
-					auto new_path = current_path;
-					new_path.push_back(adjacent_words[i]);
-					words.push(new_path);
-				}
+			auto const known = depth.find(adjacent_word);
+			if (known == depth.end() or adjacent_rungs < known->second) {
+				depth[adjacent_word] = adjacent_rungs;
+				parents[adjacent_word] = std::vector<std::string>{word};
+				open.emplace(adjacent_estimate, adjacent_rungs, std::move(adjacent_word));
+			}
+			else if (adjacent_rungs == known->second) {
+				parents[adjacent_word].push_back(word);
 			}
 		}
-		visited_globally.insert(visisted_at_level.begin(), visisted_at_level.end());
 	}
 
-	// sort the list of solutions in alphabetical order before returning
-	std::sort(shortest_paths.begin(), shortest_paths.end(), std::less_equal<std::vector<std::string>>());
+	auto shortest_paths = std::vector<std::vector<std::string>>{};
+	if (best == std::numeric_limits<std::size_t>::max()) {
+		return shortest_paths;
+	}
+	auto reversed_path = std::vector<std::string>{};
+	collect_paths(to, parents, reversed_path, shortest_paths);
+	std::sort(shortest_paths.begin(), shortest_paths.end());
 	return shortest_paths;
 }
@@ -1,6 +1,9 @@
 #ifndef COMP6771_WORD_LADDER_H
 #define COMP6771_WORD_LADDER_H
 
+#include <chrono>
+#include <cstddef>
+#include <stop_token>
 #include <unordered_set>
 #include <string>
 #include <vector>
@@ -8,6 +11,8 @@
 namespace word_ladder {
 	// Given a file path to a newline-separated list of words...
 	// Loads those words into an unordered set and returns it.
+	// Lines are split by tokenize_words: blanks around a word are trimmed, and lines that are not
+	// words of a-z are left out.
 	auto read_lexicon(const std::string &path) -> std::unordered_set<std::string>;
 
 	// Given a start word and destination word, returns all the shortest possible paths from the
@@ -22,6 +27,47 @@ namespace word_ladder {
 		const std::string &to,
 	    const std::unordered_set<std::string> &lexicon
 	) -> std::vector<std::vector<std::string>>;
+
+	// Same as generate, but returns at most limit ladders: the first ones in alphabetical order. Ladders
+	// are built in that order, so nothing past the limit is ever built or sorted.
+	// Preconditions: as for generate.
+	auto generate(
+		const std::string &from,
+		const std::string &to,
+	    const std::unordered_set<std::string> &lexicon,
+	    std::size_t limit
+	) -> std::vector<std::vector<std::string>>;
+
+	// How an interruptible generate call ended.
+	enum class search_status { complete, cancelled, timed_out };
+
+	struct search_result {
+		search_status status;
+		// Every shortest ladder if the search completed. Otherwise the ladders finished before it
+		// stopped, which are the first ones in alphabetical order, and may be none at all.
+		std::vector<std::vector<std::string>> ladders;
+	};
+
+	// Same as generate, but stops early once a stop is requested through stop or the deadline
+	// passes. Both are checked between search levels and every few dozen words within a level.
+	// Preconditions: as for generate.
+	auto generate(
+		const std::string &from,
+		const std::string &to,
+	    const std::unordered_set<std::string> &lexicon,
+	    std::stop_token stop,
+	    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max()
+	) -> search_result;
+
+	// Same result as generate, but found with an A* search that uses the number of differing letters
+	// between a word and the destination as a lower bound on the rest of the ladder. Words that
+	// cannot finish a ladder within the best length found so far are never expanded.
+	// Preconditions: as for generate.
+	auto generate_astar(
+		const std::string &from,
+		const std::string &to,
+	    const std::unordered_set<std::string> &lexicon
+	) -> std::vector<std::vector<std::string>>;
 } // namespace word_ladder
 
 #endif // COMP6771_WORD_LADDER_H
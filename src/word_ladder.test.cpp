@@ -474,3 +474,64 @@ TEST_CASE("charge -> comedo") {
     CHECK(paths_shortest_length(paths, 23));
     CHECK(path_correct_structure(paths, "charge", "comedo"));
 }
+TEST_CASE("generate_astar finds the same ladders as generate") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	CHECK(::word_ladder::generate_astar("work", "play", lexicon) == ::word_ladder::generate("work", "play", lexicon));
+	CHECK(::word_ladder::generate_astar("poise", "snarl", lexicon)
+	      == ::word_ladder::generate("poise", "snarl", lexicon));
+	CHECK(::word_ladder::generate_astar("dinner", "supper", lexicon)
+	      == ::word_ladder::generate("dinner", "supper", lexicon));
+	CHECK(::word_ladder::generate_astar("cat", "cut", lexicon)
+	      == std::vector<std::vector<std::string>>{{"cat", "cut"}});
+	CHECK(::word_ladder::generate_astar("airplane", "tricycle", lexicon).empty());
+	CHECK(::word_ladder::generate_astar("at", "at", std::unordered_set<std::string>{"at"})
+	      == std::vector<std::vector<std::string>>{{"at"}});
+}
+TEST_CASE("generate with a limit returns the first ladders in alphabetical order") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const all_paths = ::word_ladder::generate("work", "play", lexicon);
+	REQUIRE(all_paths.size() == 12);
+
+	auto const one_path = ::word_ladder::generate("work", "play", lexicon, 1);
+	CHECK(one_path == std::vector<std::vector<std::string>>{all_paths.front()});
+	auto const five_paths = ::word_ladder::generate("work", "play", lexicon, 5);
+	CHECK(five_paths == std::vector<std::vector<std::string>>(all_paths.begin(), all_paths.begin() + 5));
+	CHECK(::word_ladder::generate("work", "play", lexicon, 100) == all_paths);
+	CHECK(::word_ladder::generate("work", "play", lexicon, 0).empty());
+
+	auto const poise_paths = ::word_ladder::generate("poise", "snarl", lexicon, 3);
+	CHECK(paths_alphabetical_order(poise_paths));
+	CHECK(paths_shortest_length(poise_paths, 9));
+	CHECK(path_correct_structure(poise_paths, "poise", "snarl"));
+	CHECK(poise_paths.size() == 3);
+	CHECK(::word_ladder::generate("airplane", "tricycle", lexicon, 1).empty());
+	CHECK(::word_ladder::generate("at", "at", std::unordered_set<std::string>{"at"}, 1)
+	      == std::vector<std::vector<std::string>>{{"at"}});
+}
+TEST_CASE("interruptible generate reports how the search ended") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+
+	auto const complete = ::word_ladder::generate("work", "play", lexicon, std::stop_token{});
+	CHECK(complete.status == ::word_ladder::search_status::complete);
+	CHECK(complete.ladders == ::word_ladder::generate("work", "play", lexicon));
+
+	auto stop = std::stop_source{};
+	stop.request_stop();
+	auto const cancelled = ::word_ladder::generate("work", "play", lexicon, stop.get_token());
+	CHECK(cancelled.status == ::word_ladder::search_status::cancelled);
+	CHECK(cancelled.ladders.empty());
+
+	auto const start = std::chrono::steady_clock::now();
+	auto const timed_out = ::word_ladder::generate("atlases",
+	                                               "cabaret",
+	                                               lexicon,
+	                                               std::stop_token{},
+	                                               start + std::chrono::milliseconds(1));
+	CHECK(timed_out.status == ::word_ladder::search_status::timed_out);
+	CHECK(std::is_sorted(timed_out.ladders.begin(), timed_out.ladders.end()));
+	CHECK(std::chrono::steady_clock::now() - start < std::chrono::seconds(2));
+
+	auto const unreachable = ::word_ladder::generate("airplane", "tricycle", lexicon, std::stop_token{});
+	CHECK(unreachable.status == ::word_ladder::search_status::complete);
+	CHECK(unreachable.ladders.empty());
+}
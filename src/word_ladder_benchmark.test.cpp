@@ -1,6 +1,50 @@
+#include "async_generate.h"
+#include "batch_generate.h"
+#include "dawg_lexicon.h"
+#include "distance_oracle.h"
+#include "fixed_length.h"
+#include "flat_word_set.h"
+#include "graph_analytics.h"
+#include "graph_placement.h"
+#include "indexed_lexicon.h"
+#include "ladder_set.h"
+#include "lexicon_graph.h"
+#include "line_tokenizer.h"
+#include "neighbour_index.h"
+#include "neighbour_provider.h"
+#include "neighbour_scan.h"
+#include "neighbour_trie.h"
+#include "parallel_for.h"
+#include "parallel_loader.h"
 #include "word_ladder.h"
+#include "work_stealing.h"
 #include <catch2/catch.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <future>
+#include <iostream>
+#include <malloc.h>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <system_error>
+#include <thread>
+
+/**
+ * @brief benchmarking helper function to time a single call
+ *
+ * @param run - the work to time
+ * @return double - how long the work took, in milliseconds
+ */
+template<typename F>
+auto time_ms(F&& run) -> double {
+	auto const start = std::chrono::steady_clock::now();
+	run();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
 // the vibe is checking the number of paths and their lengths
 TEST_CASE("atlases -> cabaret") {
 	auto const english_lexicon = ::word_ladder::read_lexicon("./english.txt");
@@ -23,3 +67,780 @@ TEST_CASE("atom -> unau"){
 	auto const paths = ::word_ladder::generate("atom", "unau", lexicon);
 	CHECK(std::size(paths) != 0);
 }
+
+// A* against plain breadth-first search, one pair for each of 6 to 9 letters
+TEST_CASE("generate_astar vs generate") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const pairs = std::vector<std::pair<std::string, std::string>>{{"dinner", "supper"},
+	                                                                    {"bangers", "rustles"},
+	                                                                    {"bulliest", "peppiest"},
+	                                                                    {"retelling", "derailing"}};
+	for (auto const& [from, to] : pairs) {
+		auto bfs_paths = std::vector<std::vector<std::string>>{};
+		auto astar_paths = std::vector<std::vector<std::string>>{};
+		auto const bfs_ms = time_ms([&] { bfs_paths = ::word_ladder::generate(from, to, lexicon); });
+		auto const astar_ms = time_ms([&] { astar_paths = ::word_ladder::generate_astar(from, to, lexicon); });
+		std::cout << from << " -> " << to << ": generate " << bfs_ms << " ms, generate_astar " << astar_ms << " ms"
+		          << std::endl;
+		CHECK(astar_paths == bfs_paths);
+	}
+}
+
+// landmark-guided A* against plain breadth-first search on the same graph, for long ladders
+TEST_CASE("generate_landmarks vs graph generate") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const base = ::word_ladder::build_graph_image(lexicon);
+	auto image = std::vector<std::byte>{};
+	auto const landmarks_ms =
+	    time_ms([&] { image = ::word_ladder::build_landmarks(::word_ladder::graph_view(base.data()), 8); });
+	std::cout << "build_landmarks(8): " << landmarks_ms << " ms, " << image.size() - base.size() << " extra bytes"
+	          << std::endl;
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto const pairs = std::vector<std::pair<std::string, std::string>>{{"atlases", "cabaret"},
+	                                                                    {"charge", "comedo"},
+	                                                                    {"basics", "beaker"}};
+	for (auto const& [from, to] : pairs) {
+		auto bfs_paths = std::vector<std::vector<std::string>>{};
+		auto landmark_paths = std::vector<std::vector<std::string>>{};
+		auto const bfs_ms = time_ms([&] { bfs_paths = ::word_ladder::generate(from, to, graph); });
+		auto const landmark_ms = time_ms([&] { landmark_paths = ::word_ladder::generate_landmarks(from, to, graph); });
+		std::cout << from << " -> " << to << ": generate " << bfs_ms << " ms, generate_landmarks " << landmark_ms
+		          << " ms" << std::endl;
+		CHECK(landmark_paths == bfs_paths);
+	}
+}
+
+// neighbour lookup by scanning every word of the same length against probing the lexicon with every
+// one-letter substitution, as generate does, for a sample of words of each length
+TEST_CASE("neighbour_scan vs hash probing") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const hash_probe = [&](std::string word) {
+		auto neighbours = std::vector<std::string>{};
+		for (auto c = 'a'; c <= 'z'; ++c) {
+			for (auto i = std::size_t{0}; i < word.size(); ++i) {
+				auto const original_char = word[i];
+				if (c != original_char) {
+					word[i] = c;
+					if (lexicon.find(word) != lexicon.end()) {
+						neighbours.push_back(word);
+					}
+					word[i] = original_char;
+				}
+			}
+		}
+		return neighbours;
+	};
+	auto const scans = std::vector<::word_ladder::neighbour_scan>{
+	    ::word_ladder::neighbour_scan(lexicon, ::word_ladder::scan_kernel::scalar),
+	    ::word_ladder::neighbour_scan(lexicon, ::word_ladder::scan_kernel::avx2),
+	    ::word_ladder::neighbour_scan(lexicon, ::word_ladder::scan_kernel::avx512)};
+	auto const kernel_names = std::vector<std::string>{"scalar", "avx2", "avx512"};
+
+	for (auto length = std::size_t{2}; length <= 10; ++length) {
+		auto const words = scans.front().words_of_length(length);
+		auto const sample = words.subspan(0, std::min(words.size(), std::size_t{200}));
+		auto found = std::size_t{0};
+		std::cout << length << " letters (" << words.size() << " words): hash probe "
+		          << time_ms([&] {
+			             for (auto const& word : sample) {
+				             found += hash_probe(word).size();
+			             }
+		             }) / static_cast<double>(sample.size()) * 1000
+		          << " us/word";
+		for (auto const& scan : scans) {
+			auto scanned = std::size_t{0};
+			auto const ms = time_ms([&] {
+				for (auto const& word : sample) {
+					scanned += scan.neighbour_indexes(word).size();
+				}
+			});
+			std::cout << ", " << kernel_names[static_cast<std::size_t>(scan.kernel())] << " "
+			          << ms / static_cast<double>(sample.size()) * 1000 << " us/word";
+			CHECK(scanned == found);
+		}
+		std::cout << std::endl;
+	}
+}
+
+// the search compiled for the word length against the string search
+TEST_CASE("fixed_length_lexicon generate vs generate") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const fixed = ::word_ladder::fixed_length_lexicon(lexicon);
+	auto const pairs = std::vector<std::pair<std::string, std::string>>{{"work", "play"},
+	                                                                    {"awake", "sleep"},
+	                                                                    {"dinner", "supper"},
+	                                                                    {"bangers", "rustles"}};
+	for (auto const& [from, to] : pairs) {
+		auto string_paths = std::vector<std::vector<std::string>>{};
+		auto fixed_paths = std::vector<std::vector<std::string>>{};
+		auto const string_ms = time_ms([&] { string_paths = ::word_ladder::generate(from, to, lexicon); });
+		auto const fixed_ms = time_ms([&] { fixed_paths = ::word_ladder::generate(from, to, fixed); });
+		std::cout << from << " -> " << to << ": generate " << string_ms << " ms, fixed length " << fixed_ms << " ms"
+		          << std::endl;
+		CHECK(fixed_paths == string_paths);
+	}
+}
+
+// the flat open-addressing set against std::unordered_set, as a lexicon and as a visited set
+TEST_CASE("flat_word_set vs unordered_set") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto words = std::vector<std::string>(lexicon.begin(), lexicon.end());
+	std::sort(words.begin(), words.end());
+	auto misses = words;
+	for (auto& word : misses) {
+		word.back() = word.back() == 'z' ? 'a' : static_cast<char>(word.back() + 1);
+	}
+
+	auto std_set = std::unordered_set<std::string>{};
+	auto flat_set = ::word_ladder::flat_word_set{};
+	auto const std_build = time_ms([&] { std_set = std::unordered_set<std::string>(words.begin(), words.end()); });
+	auto const flat_build = time_ms([&] { flat_set = ::word_ladder::flat_word_set(lexicon); });
+	std::cout << "build: unordered_set " << std_build << " ms, flat_word_set " << flat_build << " ms" << std::endl;
+
+	auto std_found = std::size_t{0};
+	auto flat_found = std::size_t{0};
+	auto const std_lookup = time_ms([&] {
+		for (auto const& word : words) {
+			std_found += std_set.count(word);
+		}
+		for (auto const& word : misses) {
+			std_found += std_set.count(word);
+		}
+	});
+	auto const flat_lookup = time_ms([&] {
+		for (auto const& word : words) {
+			flat_found += std::size_t{flat_set.contains(word)};
+		}
+		for (auto const& word : misses) {
+			flat_found += std::size_t{flat_set.contains(word)};
+		}
+	});
+	std::cout << "lookup (hits and misses): unordered_set " << std_lookup << " ms, flat_word_set " << flat_lookup
+	          << " ms" << std::endl;
+	CHECK(flat_found == std_found);
+
+	// a visited set is filled and thrown away once per search
+	auto std_visited = std::unordered_set<std::string>{};
+	auto flat_visited = ::word_ladder::flat_word_set{};
+	auto const std_visit = time_ms([&] {
+		for (auto round = 0; round < 5; ++round) {
+			std_visited.clear();
+			std_visited.insert(words.begin(), words.end());
+		}
+	});
+	auto const flat_visit = time_ms([&] {
+		for (auto round = 0; round < 5; ++round) {
+			flat_visited.clear();
+			for (auto const& word : words) {
+				flat_visited.insert(word);
+			}
+		}
+	});
+	std::cout << "visited set, 5 x fill: unordered_set " << std_visit << " ms, flat_word_set " << flat_visit << " ms"
+	          << std::endl;
+	CHECK(flat_visited.size() == std_visited.size());
+
+	for (auto const& [from, to] : std::vector<std::pair<std::string, std::string>>{{"work", "play"},
+	                                                                              {"dinner", "supper"}}) {
+		auto std_paths = std::vector<std::vector<std::string>>{};
+		auto flat_paths = std::vector<std::vector<std::string>>{};
+		auto const std_ms = time_ms([&] { std_paths = ::word_ladder::generate(from, to, lexicon, 1000000); });
+		auto const flat_ms = time_ms([&] { flat_paths = ::word_ladder::generate(from, to, flat_set); });
+		std::cout << from << " -> " << to << ": sorted generate on unordered_set " << std_ms
+		          << " ms, on flat_word_set " << flat_ms << " ms" << std::endl;
+		CHECK(flat_paths == std_paths);
+	}
+}
+
+// the same graph search returning a ladder_set of ids against copying every word out as a string
+TEST_CASE("ladder_set vs vector of strings") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto const pairs = std::vector<std::pair<std::string, std::string>>{{"atlases", "cabaret"}, {"work", "play"}};
+	for (auto const& [from, to] : pairs) {
+		auto ladders = ::word_ladder::ladder_set{};
+		auto paths = std::vector<std::vector<std::string>>{};
+		auto const set_ms = time_ms([&] {
+			for (auto i = 0; i < 20; ++i) {
+				ladders = ::word_ladder::generate_ladders(from, to, graph);
+			}
+		});
+		auto const vector_ms = time_ms([&] {
+			for (auto i = 0; i < 20; ++i) {
+				paths = ::word_ladder::generate(from, to, graph);
+			}
+		});
+		std::cout << from << " -> " << to << " (" << ladders.size() << " ladders, 20 runs): generate_ladders "
+		          << set_ms << " ms, generate " << vector_ms << " ms" << std::endl;
+		CHECK(ladders.to_vectors() == paths);
+	}
+}
+
+// removing and re-adding words one at a time against rebuilding the index from scratch
+TEST_CASE("indexed_lexicon updates vs rebuild") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto indexed = ::word_ladder::indexed_lexicon{};
+	auto const rebuild_ms = time_ms([&] { indexed = ::word_ladder::indexed_lexicon(lexicon); });
+	auto const graph_ms = time_ms([&] { static_cast<void>(::word_ladder::build_graph_image(lexicon)); });
+	auto words = std::vector<std::string>(lexicon.begin(), lexicon.end());
+	std::sort(words.begin(), words.end());
+	auto sample = std::vector<std::string>{};
+	for (auto i = std::size_t{0}; i < words.size(); i += 127) {
+		sample.push_back(words[i]);
+	}
+	auto const components = indexed.component_count();
+	auto const remove_ms = time_ms([&] {
+		for (auto const& word : sample) {
+			indexed.remove_word(word);
+		}
+	});
+	auto const add_ms = time_ms([&] {
+		for (auto const& word : sample) {
+			indexed.add_word(word);
+		}
+	});
+	auto const per_word_us = [&](double ms) { return ms / static_cast<double>(sample.size()) * 1000; };
+	std::cout << "indexed_lexicon rebuild " << rebuild_ms << " ms, build_graph_image " << graph_ms << " ms; "
+	          << sample.size() << " words: remove_word " << per_word_us(remove_ms) << " us/word, add_word "
+	          << per_word_us(add_ms) << " us/word" << std::endl;
+	CHECK(indexed.size() == lexicon.size());
+	CHECK(indexed.component_count() == components);
+}
+
+// removals that split a component of the full lexicon: each word removed is the only neighbour of
+// some other word, which is cut off on its own while the rest of the component stays together
+TEST_CASE("indexed_lexicon removals that split a component") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto indexed = ::word_ladder::indexed_lexicon(lexicon);
+	auto words = std::vector<std::string>(lexicon.begin(), lexicon.end());
+	std::sort(words.begin(), words.end());
+	auto cut_words = std::vector<std::string>{};
+	for (auto const& word : words) {
+		auto const neighbours = indexed.neighbours(word);
+		if (neighbours.size() == 1 and indexed.neighbours(neighbours.front()).size() > 2
+		    and std::find(cut_words.begin(), cut_words.end(), neighbours.front()) == cut_words.end()) {
+			cut_words.push_back(neighbours.front());
+		}
+	}
+	auto const components = indexed.component_count();
+	auto split_ms = 0.0;
+	for (auto const& word : cut_words) {
+		split_ms += time_ms([&] { indexed.remove_word(word); });
+		CHECK(indexed.component_count() > components);
+		indexed.add_word(word);
+	}
+	std::cout << cut_words.size() << " splitting removals: remove_word "
+	          << split_ms / static_cast<double>(cut_words.size()) * 1000 << " us/word" << std::endl;
+	CHECK(indexed.component_count() == components);
+}
+
+// sequential loading and graph construction against the chunked parallel loader
+TEST_CASE("load_graph_image vs read_lexicon and build_graph_image") {
+	auto lexicon = std::unordered_set<std::string>{};
+	auto image = std::vector<std::byte>{};
+	auto const read_ms = time_ms([&] { lexicon = ::word_ladder::read_lexicon("./english.txt"); });
+	auto const build_ms = time_ms([&] { image = ::word_ladder::build_graph_image(lexicon); });
+	std::cout << "read_lexicon " << read_ms << " ms, build_graph_image " << build_ms << " ms" << std::endl;
+	for (auto const thread_count : {std::size_t{1}, ::word_ladder::default_thread_count(), std::size_t{8}}) {
+		auto loaded = std::unordered_set<std::string>{};
+		auto parallel_image = std::vector<std::byte>{};
+		auto const parallel_read_ms =
+		    time_ms([&] { loaded = ::word_ladder::read_lexicon("./english.txt", thread_count); });
+		auto const parallel_build_ms =
+		    time_ms([&] { parallel_image = ::word_ladder::load_graph_image("./english.txt", thread_count); });
+		std::cout << thread_count << " threads: read_lexicon " << parallel_read_ms << " ms, load_graph_image "
+		          << parallel_build_ms << " ms" << std::endl;
+		CHECK(loaded == lexicon);
+		CHECK(parallel_image == image);
+	}
+}
+
+// splitting a word list into lines with getline against the vector tokenizer, in GB/s of input
+TEST_CASE("tokenize_words vs getline") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto text = std::string{};
+	for (auto copy = 0; copy < 10; ++copy) {
+		for (auto const& word : lexicon) {
+			text += word;
+			text += '\n';
+		}
+	}
+	auto const gigabytes_per_second = [&](double ms) { return static_cast<double>(text.size()) / ms / 1e6; };
+
+	auto lines = std::vector<std::string>{};
+	auto const getline_ms = time_ms([&] {
+		auto stream = std::istringstream(text);
+		for (auto line = std::string{}; std::getline(stream, line);) {
+			lines.push_back(line);
+		}
+	});
+	std::cout << text.size() / 1000000 << " MB: getline " << gigabytes_per_second(getline_ms) << " GB/s";
+	auto const kernel_names = std::vector<std::string>{"scalar", "avx2", "avx512"};
+	for (auto const kernel :
+	     {::word_ladder::scan_kernel::scalar, ::word_ladder::scan_kernel::avx2, ::word_ladder::scan_kernel::avx512}) {
+		auto words = std::vector<std::string_view>{};
+		words.reserve(lines.size());
+		auto const ms = time_ms([&] { ::word_ladder::tokenize_words(text, words, kernel); });
+		std::cout << ", " << kernel_names[static_cast<std::size_t>(kernel)] << " " << gigabytes_per_second(ms)
+		          << " GB/s";
+		CHECK(words.size() == lines.size());
+	}
+	std::cout << std::endl;
+}
+
+// memory per word and neighbour lookups of the DAWG against the hash set; the hash set's memory is
+// what the allocator hands out for a copy of it
+TEST_CASE("dawg_lexicon vs unordered_set") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const heap_before = ::mallinfo2().uordblks;
+	auto const copy = lexicon;
+	auto const set_bytes = ::mallinfo2().uordblks - heap_before;
+	auto dawg = std::optional<::word_ladder::dawg_lexicon>{};
+	auto const build_ms = time_ms([&] { dawg.emplace(lexicon); });
+	auto const words = static_cast<double>(lexicon.size());
+	std::cout << "unordered_set " << static_cast<double>(set_bytes) / words << " bytes/word, dawg "
+	          << static_cast<double>(dawg->size_bytes()) / words << " bytes/word (" << dawg->edge_count()
+	          << " edges, built in " << build_ms << " ms)" << std::endl;
+
+	auto sample = std::vector<std::string>{};
+	for (auto const& word : copy) {
+		if (sample.size() == 5000) {
+			break;
+		}
+		sample.push_back(word);
+	}
+	auto probed = std::size_t{0};
+	auto const probe_ms = time_ms([&] {
+		for (auto word : sample) {
+			for (auto i = std::size_t{0}; i < word.size(); ++i) {
+				auto const original_char = word[i];
+				for (auto c = 'a'; c <= 'z'; ++c) {
+					if (c != original_char) {
+						word[i] = c;
+						probed += std::size_t{lexicon.contains(word)};
+					}
+				}
+				word[i] = original_char;
+			}
+		}
+	});
+	auto walked = std::size_t{0};
+	auto const walk_ms = time_ms([&] {
+		for (auto const& word : sample) {
+			walked += dawg->neighbours(word).size();
+		}
+	});
+	auto const per_word_us = [&](double ms) { return ms / static_cast<double>(sample.size()) * 1000; };
+	std::cout << "neighbours: hash probe " << per_word_us(probe_ms) << " us/word, dawg walk " << per_word_us(walk_ms)
+	          << " us/word" << std::endl;
+	CHECK(walked == probed);
+}
+
+// the trie walk against the substitution loop of find_words, on every word length
+TEST_CASE("neighbour_trie vs substitution") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const substitute = [&](std::string word) {
+		auto neighbours = std::vector<std::string>{};
+		for (auto c = 'a'; c <= 'z'; ++c) {
+			for (auto i = std::size_t{0}; i < word.size(); ++i) {
+				auto const original_char = word[i];
+				if (c != original_char) {
+					word[i] = c;
+					if (lexicon.find(word) != lexicon.end()) {
+						neighbours.push_back(word);
+					}
+					word[i] = original_char;
+				}
+			}
+		}
+		return neighbours;
+	};
+	auto const trie = ::word_ladder::neighbour_trie(lexicon);
+
+	for (auto length = std::size_t{1}; length <= 29; ++length) {
+		auto const words = trie.words_of_length(length);
+		if (words.empty()) {
+			continue;
+		}
+		// every word of the length, or an even spread of 1000 of them
+		auto const step = std::max(std::size_t{1}, words.size() / 1000);
+		auto substituted = std::size_t{0};
+		auto const substitute_ms = time_ms([&] {
+			for (auto i = std::size_t{0}; i < words.size(); i += step) {
+				substituted += substitute(words[i]).size();
+			}
+		});
+		auto walked = std::size_t{0};
+		auto const walk_ms = time_ms([&] {
+			for (auto i = std::size_t{0}; i < words.size(); i += step) {
+				walked += trie.neighbours(words[i]).size();
+			}
+		});
+		auto const sampled = static_cast<double>((words.size() + step - 1) / step);
+		std::cout << length << " letters (" << words.size() << " words): substitution "
+		          << substitute_ms / sampled * 1000 << " us/word, trie walk " << walk_ms / sampled * 1000
+		          << " us/word" << std::endl;
+		CHECK(walked == substituted);
+	}
+}
+
+// the two bucket layouts: memory, neighbour lookups, and generate through the provider interface
+TEST_CASE("deletion_index vs wildcard_index") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const build = [&]<typename Index>(std::optional<Index>& index) {
+		auto const heap_before = ::mallinfo2().uordblks;
+		auto const ms = time_ms([&] { index.emplace(lexicon); });
+		std::cout << static_cast<double>(::mallinfo2().uordblks - heap_before) / 1e6 << " MB, built in " << ms
+		          << " ms";
+	};
+	auto wildcard = std::optional<::word_ladder::wildcard_index>{};
+	auto deletion = std::optional<::word_ladder::deletion_index>{};
+	std::cout << "wildcard_index ";
+	build(wildcard);
+	std::cout << "; deletion_index ";
+	build(deletion);
+	std::cout << std::endl;
+
+	auto sample = std::vector<std::string>{};
+	for (auto const& word : lexicon) {
+		if (sample.size() == 5000) {
+			break;
+		}
+		sample.push_back(word);
+	}
+	auto const lookup_us = [&](const auto& index, std::size_t& found) {
+		return time_ms([&] {
+			       for (auto const& word : sample) {
+				       found += index.neighbour_indexes(word).size();
+			       }
+		       })
+		       / static_cast<double>(sample.size()) * 1000;
+	};
+	auto wildcard_found = std::size_t{0};
+	auto deletion_found = std::size_t{0};
+	std::cout << "neighbours: wildcard " << lookup_us(*wildcard, wildcard_found) << " us/word, deletion "
+	          << lookup_us(*deletion, deletion_found) << " us/word" << std::endl;
+	CHECK(wildcard_found == deletion_found);
+
+	auto expected = std::vector<std::vector<std::string>>{};
+	auto const lexicon_ms = time_ms([&] { expected = ::word_ladder::generate("atlases", "cabaret", lexicon); });
+	auto wildcard_ladders = std::vector<std::vector<std::string>>{};
+	auto const wildcard_ms =
+	    time_ms([&] { wildcard_ladders = ::word_ladder::generate("atlases", "cabaret", *wildcard); });
+	auto deletion_ladders = std::vector<std::vector<std::string>>{};
+	auto const deletion_ms =
+	    time_ms([&] { deletion_ladders = ::word_ladder::generate("atlases", "cabaret", *deletion); });
+	std::cout << "atlases -> cabaret: lexicon " << lexicon_ms << " ms, wildcard " << wildcard_ms << " ms, deletion "
+	          << deletion_ms << " ms" << std::endl;
+	CHECK(wildcard_ladders == expected);
+	CHECK(deletion_ladders == expected);
+}
+
+// the same search over every neighbour provider
+TEST_CASE("generate over every neighbour provider") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const substitution = ::word_ladder::substitution_provider(lexicon);
+	auto const graph = ::word_ladder::graph_provider(::word_ladder::graph_view(image.data()));
+	auto const wildcard = ::word_ladder::wildcard_index(lexicon);
+	auto const deletion = ::word_ladder::deletion_index(lexicon);
+	auto const scan = ::word_ladder::neighbour_scan(lexicon);
+	auto const trie = ::word_ladder::neighbour_trie(lexicon);
+
+	for (auto const& [from, to] : std::vector<std::pair<std::string, std::string>>{{"atlases", "cabaret"},
+	                                                                              {"work", "play"}}) {
+		auto const expected = ::word_ladder::generate(from, to, lexicon);
+		std::cout << from << " -> " << to << ":";
+		auto const run = [&](const char* name, const auto& provider) {
+			auto ladders = std::vector<std::vector<std::string>>{};
+			std::cout << " " << name << " " << time_ms([&] { ladders = ::word_ladder::generate(from, to, provider); })
+			          << " ms";
+			CHECK(ladders == expected);
+		};
+		run("substitution", substitution);
+		run("graph", graph);
+		run("wildcard", wildcard);
+		run("deletion", deletion);
+		run("scan", scan);
+		run("trie", trie);
+		std::cout << std::endl;
+	}
+}
+
+// precomputed distances for short words against the graph search
+TEST_CASE("distance_oracle generate vs graph generate") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto oracle = std::optional<::word_ladder::distance_oracle>{};
+	auto const build_ms = time_ms([&] { oracle.emplace(graph); });
+	std::cout << "oracle for lengths 2-4: " << static_cast<double>(oracle->size_bytes()) / 1e6 << " MB, built in "
+	          << build_ms << " ms on " << ::word_ladder::default_thread_count() << " threads" << std::endl;
+
+	for (auto const& [from, to] : std::vector<std::pair<std::string, std::string>>{
+	         {"go", "if"}, {"chi", "ego"}, {"cat", "dog"}, {"work", "play"}, {"atom", "unau"}}) {
+		auto const repeats = 200;
+		auto expected = std::vector<std::vector<std::string>>{};
+		auto const graph_ms = time_ms([&] {
+			for (auto i = 0; i < repeats; ++i) {
+				expected = ::word_ladder::generate(from, to, graph);
+			}
+		});
+		auto ladders = std::vector<std::vector<std::string>>{};
+		auto const oracle_ms = time_ms([&] {
+			for (auto i = 0; i < repeats; ++i) {
+				ladders = ::word_ladder::generate(from, to, *oracle);
+			}
+		});
+		std::cout << from << " -> " << to << " (" << expected.size() << " ladders): graph " << graph_ms / repeats * 1000
+		          << " us, oracle " << oracle_ms / repeats * 1000 << " us" << std::endl;
+		CHECK(ladders == expected);
+	}
+}
+
+// generate on pairs with long ladders, all of them and just the first
+TEST_CASE("generate on long ladders") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	for (auto const& [from, to] : std::vector<std::pair<std::string, std::string>>{
+	         {"atlases", "cabaret"}, {"atom", "unau"}, {"work", "play"}, {"chi", "ego"}}) {
+		auto ladders = std::vector<std::vector<std::string>>{};
+		auto const all_ms = time_ms([&] { ladders = ::word_ladder::generate(from, to, lexicon); });
+		auto first = std::vector<std::vector<std::string>>{};
+		auto const first_ms = time_ms([&] { first = ::word_ladder::generate(from, to, lexicon, 1); });
+		std::cout << from << " -> " << to << " (" << ladders.size() << " ladders of " << ladders.front().size()
+		          << "): all " << all_ms << " ms, first " << first_ms << " ms" << std::endl;
+		CHECK(first.front() == ladders.front());
+	}
+}
+
+// the worst-case queries of every length, picked by the graph analytics
+TEST_CASE("generate on the hardest pair of each length") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	for (auto length = std::size_t{2}; length <= 10; ++length) {
+		auto const report = ::word_ladder::analyse_length(graph, length, 1, 1);
+		for (auto const& pair : {report.longest.front(), report.most_ladders.front()}) {
+			auto ladders = std::vector<std::vector<std::string>>{};
+			auto const lexicon_ms = time_ms([&] { ladders = ::word_ladder::generate(pair.from, pair.to, lexicon); });
+			auto const graph_ms = time_ms([&] { ::word_ladder::generate(pair.from, pair.to, graph); });
+			std::cout << pair.from << " -> " << pair.to << " (" << pair.rungs << " rungs, " << pair.ladders
+			          << " ladders): lexicon " << lexicon_ms << " ms, graph " << graph_ms << " ms" << std::endl;
+			CHECK(ladders.size() == pair.ladders);
+		}
+	}
+}
+
+// the graph copied into each page and NUMA placement, under searches and a random walk of its edges
+TEST_CASE("placed_graph page and NUMA modes") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto random = std::mt19937(6771);
+	auto queries = std::vector<std::pair<std::string, std::string>>{};
+	for (auto length = std::size_t{4}; length <= 8; ++length) {
+		auto const [first, last] = graph.ids_of_length(length);
+		auto pick = std::uniform_int_distribution<std::uint32_t>(first, last - 1);
+		while (queries.size() < (length - 3) * 40) {
+			auto const from = pick(random);
+			auto const to = pick(random);
+			if (graph.component(from) == graph.component(to)) {
+				queries.emplace_back(graph.word(from), graph.word(to));
+			}
+		}
+	}
+	std::cout << ::word_ladder::numa_node_count() << " NUMA node(s), " << queries.size() << " queries" << std::endl;
+
+	auto const page_names = std::vector<std::string>{"normal", "transparent huge", "explicit huge"};
+	auto const numa_names = std::vector<std::string>{"none", "interleave", "replicate"};
+	for (auto const pages : {::word_ladder::page_mode::normal,
+	                         ::word_ladder::page_mode::transparent_huge,
+	                         ::word_ladder::page_mode::explicit_huge}) {
+		for (auto const numa : {::word_ladder::numa_mode::none,
+		                        ::word_ladder::numa_mode::interleave,
+		                        ::word_ladder::numa_mode::replicate}) {
+			std::cout << page_names[static_cast<std::size_t>(pages)] << " pages, numa "
+			          << numa_names[static_cast<std::size_t>(numa)] << ": ";
+			auto placed = std::optional<::word_ladder::placed_graph>{};
+			try {
+				placed.emplace(graph, ::word_ladder::placement_options{pages, numa});
+			} catch (const std::system_error& error) {
+				std::cout << "unavailable (" << error.what() << ")" << std::endl;
+				continue;
+			}
+			auto const view = placed->view();
+			auto ladders = std::size_t{0};
+			auto const search_ms = time_ms([&] {
+				for (auto const& [from, to] : queries) {
+					ladders += ::word_ladder::generate_ladders(from, to, view).size();
+				}
+			});
+			// every step reads a random word's adjacency list, so it is mostly cache and TLB misses
+			auto id = std::uint32_t{0};
+			auto steps = std::uint64_t{0x9e3779b97f4a7c15};
+			auto const walk_ms = time_ms([&] {
+				for (auto step = 0; step < 4'000'000; ++step) {
+					steps = steps * 6364136223846793005 + 1442695040888963407;
+					auto const neighbours = view.neighbours(id);
+					id = neighbours.empty() ? static_cast<std::uint32_t>((steps >> 33) % view.word_count())
+					                        : neighbours[(steps >> 33) % neighbours.size()];
+				}
+			});
+			std::cout << queries.size() << " searches " << search_ms << " ms, 4M-step walk " << walk_ms << " ms"
+			          << std::endl;
+			CHECK(ladders > 0);
+		}
+	}
+}
+
+// a batch whose cost is skewed: the hardest pairs of every length first, then many cheap 3-letter
+// queries. A worker's share of the batch is timed in thread CPU time, so the makespan the slowest
+// share sets shows even when the workers share fewer cores than there are of them
+TEST_CASE("work stealing vs static split on a skewed batch") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto queries = std::vector<std::pair<std::string, std::string>>{};
+	for (auto length = std::size_t{2}; length <= 10; ++length) {
+		auto const report = ::word_ladder::analyse_length(graph, length, 1, 1);
+		queries.emplace_back(report.longest.front().from, report.longest.front().to);
+		queries.emplace_back(report.most_ladders.front().from, report.most_ladders.front().to);
+	}
+	auto random = std::mt19937(6771);
+	auto const [first, last] = graph.ids_of_length(3);
+	auto pick = std::uniform_int_distribution<std::uint32_t>(first, last - 1);
+	while (queries.size() < 600) {
+		auto const from = pick(random);
+		auto const to = pick(random);
+		if (from != to and graph.component(from) == graph.component(to)) {
+			queries.emplace_back(graph.word(from), graph.word(to));
+		}
+	}
+	auto const thread_cpu_ms = [] {
+		auto now = timespec{};
+		::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+		return static_cast<double>(now.tv_sec) * 1e3 + static_cast<double>(now.tv_nsec) / 1e6;
+	};
+	auto const report = [](const std::vector<double>& busy_ms, double wall_ms) {
+		auto const slowest = *std::max_element(busy_ms.begin(), busy_ms.end());
+		auto total = 0.0;
+		for (auto const ms : busy_ms) {
+			total += ms;
+		}
+		std::cout << "wall " << wall_ms << " ms, slowest worker " << slowest << " ms, utilisation "
+		          << 100 * total / (slowest * static_cast<double>(busy_ms.size())) << "%" << std::endl;
+	};
+
+	for (auto const thread_count : {std::size_t{2}, std::size_t{4}, std::size_t{8}}) {
+		auto static_ladders = std::vector<std::size_t>(queries.size());
+		auto static_busy = std::vector<double>(thread_count);
+		auto const static_ms = time_ms([&] {
+			auto threads = std::vector<std::jthread>{};
+			for (auto t = std::size_t{0}; t < thread_count; ++t) {
+				threads.emplace_back([&, t] {
+					auto const start = thread_cpu_ms();
+					auto const end = queries.size() * (t + 1) / thread_count;
+					for (auto i = queries.size() * t / thread_count; i < end; ++i) {
+						auto const& [from, to] = queries[i];
+						static_ladders[i] = ::word_ladder::generate_ladders(from, to, graph).size();
+					}
+					static_busy[t] = thread_cpu_ms() - start;
+				});
+			}
+		});
+		std::cout << thread_count << " threads, " << queries.size() << " queries, static split: ";
+		report(static_busy, static_ms);
+
+		// the same search per query, scheduled by the executor instead
+		auto executor = ::word_ladder::work_stealing_executor(thread_count);
+		auto const print_stats = [&](const std::string& name, double wall_ms) {
+			auto busy = std::vector<double>{};
+			auto steals = std::uint64_t{0};
+			auto waiting = std::chrono::nanoseconds{0};
+			for (auto const& worker : executor.stats()) {
+				busy.push_back(std::chrono::duration<double, std::milli>(worker.busy).count());
+				steals += worker.steals;
+				waiting += worker.waiting;
+			}
+			std::cout << thread_count << " threads, " << name << " (" << steals << " steals, "
+			          << std::chrono::duration<double, std::milli>(waiting).count() << " ms waiting): ";
+			report(busy, wall_ms);
+			executor.reset_stats();
+		};
+		auto stealing_ladders = std::vector<std::size_t>(queries.size());
+		auto const stealing_ms = time_ms([&] {
+			executor.for_each(queries.size(), [&](std::size_t i) {
+				auto const& [from, to] = queries[i];
+				stealing_ladders[i] = ::word_ladder::generate_ladders(from, to, graph).size();
+			});
+		});
+		print_stats("work stealing", stealing_ms);
+
+		auto results = std::vector<::word_ladder::ladder_set>{};
+		auto const batch_ms = time_ms([&] { results = ::word_ladder::generate_batch(queries, graph, executor); });
+		print_stats("generate_batch", batch_ms);
+
+		auto matching = std::size_t{0};
+		for (auto i = std::size_t{0}; i < queries.size(); ++i) {
+			matching += stealing_ladders[i] == static_ladders[i] and results[i].size() == static_ladders[i];
+		}
+		CHECK(matching == queries.size());
+	}
+}
+
+// how long a request thread is held up handing a batch to the executor, against waiting for it
+TEST_CASE("generate_async submission vs blocking generate_batch") {
+	auto const lexicon = ::word_ladder::read_lexicon("./english.txt");
+	auto const image = ::word_ladder::build_graph_image(lexicon);
+	auto const graph = ::word_ladder::graph_view(image.data());
+	auto random = std::mt19937(6771);
+	auto queries = std::vector<std::pair<std::string, std::string>>{};
+	for (auto length = std::size_t{3}; length <= 6; ++length) {
+		auto const [first, last] = graph.ids_of_length(length);
+		auto pick = std::uniform_int_distribution<std::uint32_t>(first, last - 1);
+		while (queries.size() < (length - 2) * 150) {
+			auto const from = pick(random);
+			auto const to = pick(random);
+			if (from != to and graph.component(from) == graph.component(to)) {
+				queries.emplace_back(graph.word(from), graph.word(to));
+			}
+		}
+	}
+	auto executor = ::word_ladder::work_stealing_executor(4);
+
+	auto blocking = std::vector<::word_ladder::ladder_set>{};
+	auto const blocking_ms = time_ms([&] { blocking = ::word_ladder::generate_batch(queries, graph, executor); });
+
+	auto futures = std::vector<std::future<::word_ladder::ladder_set>>{};
+	auto const single_submit_ms = time_ms([&] {
+		for (auto const& [from, to] : queries) {
+			futures.push_back(::word_ladder::generate_async(from, to, graph, executor));
+		}
+	});
+	auto single_ladders = std::size_t{0};
+	auto const single_total_ms = single_submit_ms + time_ms([&] {
+		                             for (auto& future : futures) {
+			                             single_ladders += future.get().size();
+		                             }
+	                             });
+
+	auto batch = std::future<std::vector<::word_ladder::ladder_set>>{};
+	auto const batch_submit_ms =
+	    time_ms([&] { batch = ::word_ladder::generate_batch_async(queries, graph, executor); });
+	auto results = std::vector<::word_ladder::ladder_set>{};
+	auto const batch_total_ms = batch_submit_ms + time_ms([&] { results = batch.get(); });
+
+	std::cout << queries.size() << " queries: generate_batch blocks " << blocking_ms << " ms; generate_async each "
+	          << "submits in " << single_submit_ms << " ms, done in " << single_total_ms
+	          << " ms; generate_batch_async submits in " << batch_submit_ms << " ms, done in " << batch_total_ms
+	          << " ms" << std::endl;
+	auto blocking_ladders = std::size_t{0};
+	auto batch_ladders = std::size_t{0};
+	for (auto i = std::size_t{0}; i < queries.size(); ++i) {
+		blocking_ladders += blocking[i].size();
+		batch_ladders += results[i].size();
+	}
+	CHECK(single_ladders == blocking_ladders);
+	CHECK(batch_ladders == blocking_ladders);
+}
@@ -0,0 +1,245 @@
+#include "work_stealing.h"
+// data structures
+#include <deque>
+#include <vector>
+// other functionality
+#include <algorithm>
+#include <ctime>
+#include <iterator>
+#include <exception>
+#include <utility>
+
+namespace {
+	// the executor and worker the calling thread belongs to, if any
+	thread_local const word_ladder::work_stealing_executor* current_executor = nullptr;
+	thread_local std::size_t current_worker = 0;
+	// how many tasks the calling worker is inside of; only the outermost one counts as busy time
+	thread_local std::size_t task_depth = 0;
+
+	auto thread_cpu_time() -> std::chrono::nanoseconds {
+		auto now = timespec{};
+		::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+		return std::chrono::seconds(now.tv_sec) + std::chrono::nanoseconds(now.tv_nsec);
+	}
+} // namespace
+
+word_ladder::work_stealing_executor::work_stealing_executor(std::size_t thread_count) {
+	thread_count = std::max(thread_count, std::size_t{1});
+	for (auto i = std::size_t{0}; i < thread_count; ++i) {
+		workers_.push_back(std::make_unique<worker>());
+	}
+	for (auto i = std::size_t{0}; i < thread_count; ++i) {
+		threads_.emplace_back([this, i] { work(i); });
+	}
+}
+
+word_ladder::work_stealing_executor::~work_stealing_executor() {
+	{
+		auto const lock = std::scoped_lock(sleep_mutex_);
+		stopping_ = true;
+	}
+	wake_.notify_all();
+	threads_.clear();
+}
+
+auto word_ladder::work_stealing_executor::thread_count() const -> std::size_t {
+	return workers_.size();
+}
+
+struct word_ladder::work_stealing_executor::task_group {
+	std::atomic<std::size_t> remaining;
+	// the tasks of the group still on a deque
+	std::atomic<std::size_t> queued;
+	std::mutex mutex;
+	std::condition_variable done;
+	std::exception_ptr failure;
+};
+
+auto word_ladder::work_stealing_executor::submit(std::function<void()> task) -> void {
+	push(queued_task{std::move(task)});
+}
+
+auto word_ladder::work_stealing_executor::push(queued_task task) -> void {
+	auto const index = current_executor == this ? current_worker : next_deque_.fetch_add(1) % workers_.size();
+	{
+		auto const lock = std::scoped_lock(workers_[index]->mutex);
+		workers_[index]->tasks.push_back(std::move(task));
+	}
+	{
+		auto const lock = std::scoped_lock(sleep_mutex_);
+		++queued_;
+	}
+	wake_.notify_one();
+}
+
+/**
+ * @brief the newest task of the worker's own deque, or else the oldest task of the first other deque
+ * that has one, trying them from the next worker round. Given a group, the same but skipping the
+ * tasks of any other group; the deques are short, so scanning them costs little
+ *
+ * @param index - the worker taking a task
+ * @param group - the only group to take a task of, or null for any task
+ * @return std::function<void()> - the task, or an empty function if there is none
+ */
+auto word_ladder::work_stealing_executor::take(std::size_t index, task_group* group) -> std::function<void()> {
+	auto task = std::function<void()>{};
+	auto const pop = [&](std::deque<queued_task>& tasks, std::deque<queued_task>::iterator found) {
+		task = std::move(found->run);
+		if (found->group != nullptr) {
+			--found->group->queued;
+		}
+		tasks.erase(found);
+		--queued_;
+	};
+	auto const wanted = [&](const queued_task& queued) { return group == nullptr or queued.group == group; };
+	{
+		auto& own = *workers_[index];
+		auto const lock = std::scoped_lock(own.mutex);
+		auto const newest = std::find_if(own.tasks.rbegin(), own.tasks.rend(), wanted);
+		if (newest != own.tasks.rend()) {
+			pop(own.tasks, std::prev(newest.base()));
+			return task;
+		}
+	}
+	for (auto offset = std::size_t{1}; offset < workers_.size() and not task; ++offset) {
+		auto& victim = *workers_[(index + offset) % workers_.size()];
+		auto const lock = std::scoped_lock(victim.mutex);
+		auto const oldest = std::find_if(victim.tasks.begin(), victim.tasks.end(), wanted);
+		if (oldest != victim.tasks.end()) {
+			pop(victim.tasks, oldest);
+		}
+	}
+	if (task) {
+		// counted once the victim's lock is gone, as two workers may be stealing from each other
+		auto const lock = std::scoped_lock(workers_[index]->mutex);
+		++workers_[index]->stats.steals;
+	}
+	return task;
+}
+
+auto word_ladder::work_stealing_executor::run(std::size_t index, std::function<void()>& task) -> void {
+	{
+		// counted before the task runs, so a for_each that returns has every one of its tasks counted
+		auto const lock = std::scoped_lock(workers_[index]->mutex);
+		++workers_[index]->stats.tasks;
+	}
+	auto const start = task_depth == 0 ? thread_cpu_time() : std::chrono::nanoseconds{0};
+	++task_depth;
+	try {
+		task();
+	} catch (...) {
+		// submit documents that exceptions are swallowed; for_each catches its own
+	}
+	--task_depth;
+	if (task_depth == 0) {
+		auto const lock = std::scoped_lock(workers_[index]->mutex);
+		workers_[index]->stats.busy += thread_cpu_time() - start;
+	}
+}
+
+/**
+ * @brief the loop of one worker: run tasks while there are any, sleep while there are none, and
+ * leave once the executor is stopping and every deque is empty
+ *
+ * @param index - the worker
+ */
+auto word_ladder::work_stealing_executor::work(std::size_t index) -> void {
+	current_executor = this;
+	current_worker = index;
+	for (;;) {
+		auto task = take(index);
+		if (task) {
+			run(index, task);
+			continue;
+		}
+		auto lock = std::unique_lock(sleep_mutex_);
+		wake_.wait(lock, [&] { return queued_ > 0 or stopping_; });
+		if (stopping_ and queued_ <= 0) {
+			return;
+		}
+	}
+}
+
+/**
+ * @brief push one task per index, tagged with a group, and wait for them with a countdown. A worker
+ * waiting on its own subtasks keeps taking the group's tasks, its own first, so it never blocks a
+ * thread the subtasks need, and never takes another group's, so it is not stuck running someone
+ * else's work after its own is done. Once none of the group's are queued, the rest are running on
+ * other workers, and it sleeps until the last one counts down. It sleeps apart from the idle workers,
+ * so a new task wakes a worker that can run it
+ *
+ * @param count - the number of tasks
+ * @param task - the work for one index
+ */
+auto word_ladder::work_stealing_executor::for_each(std::size_t count, const std::function<void(std::size_t)>& task)
+    -> void {
+	auto group = task_group{};
+	group.remaining = count;
+	group.queued = count;
+	for (auto i = std::size_t{0}; i < count; ++i) {
+		auto run_index = [this, &group, &task, i] {
+			try {
+				task(i);
+			} catch (...) {
+				auto const lock = std::scoped_lock(group.mutex);
+				if (not group.failure) {
+					group.failure = std::current_exception();
+				}
+			}
+			{
+				auto const lock = std::scoped_lock(group.mutex);
+				if (--group.remaining != 0) {
+					return;
+				}
+				group.done.notify_all();
+			}
+			// a worker waiting on the group sleeps on finished_; the group may be gone by now
+			auto const lock = std::scoped_lock(sleep_mutex_);
+			finished_.notify_all();
+		};
+		push(queued_task{std::move(run_index), &group});
+	}
+	if (current_executor == this) {
+		auto const index = current_worker;
+		while (group.remaining > 0) {
+			auto next = take(index, &group);
+			if (next) {
+				run(index, next);
+				continue;
+			}
+			auto const start = std::chrono::steady_clock::now();
+			{
+				// the group's tasks are all queued before this, so once none are left none come back
+				auto lock = std::unique_lock(sleep_mutex_);
+				finished_.wait(lock, [&] { return group.queued > 0 or group.remaining == 0; });
+			}
+			auto const lock = std::scoped_lock(workers_[index]->mutex);
+			workers_[index]->stats.waiting += std::chrono::steady_clock::now() - start;
+		}
+	}
+	else {
+		auto lock = std::unique_lock(group.mutex);
+		group.done.wait(lock, [&] { return group.remaining == 0; });
+	}
+	// the last task may still hold the mutex it counted down under; taking it waits for it to let go
+	auto const lock = std::scoped_lock(group.mutex);
+	if (group.failure) {
+		std::rethrow_exception(group.failure);
+	}
+}
+
+auto word_ladder::work_stealing_executor::stats() const -> std::vector<worker_stats> {
+	auto all = std::vector<worker_stats>{};
+	for (auto const& each : workers_) {
+		auto const lock = std::scoped_lock(each->mutex);
+		all.push_back(each->stats);
+	}
+	return all;
+}
+
+auto word_ladder::work_stealing_executor::reset_stats() -> void {
+	for (auto const& each : workers_) {
+		auto const lock = std::scoped_lock(each->mutex);
+		each->stats = worker_stats{};
+	}
+}
@@ -0,0 +1,90 @@
+#ifndef COMP6771_WORK_STEALING_H
+#define COMP6771_WORK_STEALING_H
+
+#include "parallel_for.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace word_ladder {
+	// A pool of worker threads, each with its own deque of tasks. A worker runs the newest task of its
+	// own deque and, when that is empty, steals the oldest task of another's, so a batch whose tasks
+	// differ in cost by orders of magnitude keeps every worker busy until the batch runs out, where a
+	// static split leaves the workers with cheap shares idle. Tasks a worker submits go on its own
+	// deque, so a task that splits its work into subtasks keeps them local until someone is idle.
+	class work_stealing_executor {
+	public:
+		// What one worker did since the executor started or stats were last reset.
+		struct worker_stats {
+			std::uint64_t tasks = 0; // tasks started
+			std::uint64_t steals = 0;
+			std::chrono::nanoseconds busy{0}; // thread CPU time spent running tasks
+			// wall time spent asleep in a for_each whose remaining tasks were all running elsewhere;
+			// it is not part of busy, as a sleeping thread uses no CPU time
+			std::chrono::nanoseconds waiting{0};
+		};
+
+		explicit work_stealing_executor(std::size_t thread_count = default_thread_count());
+		work_stealing_executor(const work_stealing_executor&) = delete;
+		auto operator=(const work_stealing_executor&) -> work_stealing_executor& = delete;
+		// Finishes every task already submitted, then joins the workers.
+		~work_stealing_executor();
+
+		auto thread_count() const -> std::size_t;
+
+		// Queues a task. From a worker it goes on that worker's deque, from any other thread on the
+		// deques in turn. An exception a task throws is swallowed; tasks that need to report failure
+		// should catch it themselves.
+		auto submit(std::function<void()> task) -> void;
+
+		// Runs task(i) for every i in [0, count) as stealable tasks and returns once all have finished.
+		// A worker that calls it runs the call's own tasks while any are queued instead of blocking, so
+		// tasks can split their own work this way, and sleeps only while the last ones run on other
+		// workers. It never starts an unrelated task while it waits, which would hold up the call for
+		// as long as that task runs. If any task throws, the first exception is rethrown.
+		auto for_each(std::size_t count, const std::function<void(std::size_t)>& task) -> void;
+
+		auto stats() const -> std::vector<worker_stats>;
+		auto reset_stats() -> void;
+
+	private:
+		// the tasks of one for_each call, which its caller waits on
+		struct task_group;
+		struct queued_task {
+			std::function<void()> run;
+			task_group* group = nullptr; // null for a submitted task
+		};
+		struct worker {
+			mutable std::mutex mutex;
+			std::deque<queued_task> tasks;
+			worker_stats stats;
+		};
+
+		auto push(queued_task task) -> void;
+		auto work(std::size_t index) -> void;
+		// Pops from the worker's own deque, or steals from another's; with a group, only tasks of that
+		// group are taken. Returns an empty function if there is none.
+		auto take(std::size_t index, task_group* group = nullptr) -> std::function<void()>;
+		auto run(std::size_t index, std::function<void()>& task) -> void;
+
+		std::vector<std::unique_ptr<worker>> workers_;
+		std::atomic<std::ptrdiff_t> queued_ = 0;
+		std::atomic<std::size_t> next_deque_ = 0;
+		std::mutex sleep_mutex_;
+		std::condition_variable wake_; // idle workers
+		std::condition_variable finished_; // workers waiting in for_each for a group to finish
+		bool stopping_ = false;
+		std::vector<std::jthread> threads_;
+	};
+} // namespace word_ladder
+
+#endif // COMP6771_WORK_STEALING_H
@@ -0,0 +1,135 @@
+#include "work_stealing.h"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <latch>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_CASE("for_each runs every index exactly once") {
+	for (auto const thread_count : {std::size_t{1}, std::size_t{3}, std::size_t{8}}) {
+		auto executor = ::word_ladder::work_stealing_executor(thread_count);
+		CHECK(executor.thread_count() == thread_count);
+		auto runs = std::vector<std::atomic<int>>(1000);
+		executor.for_each(runs.size(), [&](std::size_t i) { ++runs[i]; });
+		for (auto const& count : runs) {
+			CHECK(count == 1);
+		}
+		auto tasks = std::uint64_t{0};
+		for (auto const& worker : executor.stats()) {
+			tasks += worker.tasks;
+		}
+		CHECK(tasks == runs.size());
+		executor.reset_stats();
+		for (auto const& worker : executor.stats()) {
+			CHECK(worker.tasks == 0);
+			CHECK(worker.steals == 0);
+			CHECK(worker.waiting == std::chrono::nanoseconds{0});
+		}
+	}
+	auto executor = ::word_ladder::work_stealing_executor(2);
+	auto ran = false;
+	executor.for_each(0, [&](std::size_t) { ran = true; });
+	CHECK_FALSE(ran);
+}
+
+TEST_CASE("tasks can split their work with a nested for_each") {
+	// one worker is the hardest case: the outer task must run its own subtasks while it waits
+	for (auto const thread_count : {std::size_t{1}, std::size_t{4}}) {
+		auto executor = ::word_ladder::work_stealing_executor(thread_count);
+		auto runs = std::vector<std::atomic<int>>(20 * 50);
+		executor.for_each(20, [&](std::size_t outer) {
+			executor.for_each(50, [&](std::size_t inner) { ++runs[outer * 50 + inner]; });
+		});
+		auto all_once = true;
+		for (auto const& count : runs) {
+			all_once = all_once and count == 1;
+		}
+		CHECK(all_once);
+	}
+}
+
+TEST_CASE("a worker sleeps while its stolen subtasks run elsewhere") {
+	auto executor = ::word_ladder::work_stealing_executor(2);
+	executor.for_each(1, [&](std::size_t) {
+		// the subtask the caller keeps cannot finish until the other has been stolen and started, and
+		// the stolen one runs on long after, so the caller is left with nothing to do but wait
+		auto started = std::latch(2);
+		executor.for_each(2, [&](std::size_t i) {
+			started.arrive_and_wait();
+			if (i == 0) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			}
+		});
+	});
+	auto waiting = std::chrono::nanoseconds{0};
+	auto busy = std::chrono::nanoseconds{0};
+	for (auto const& worker : executor.stats()) {
+		waiting += worker.waiting;
+		busy += worker.busy;
+	}
+	CHECK(waiting >= std::chrono::milliseconds(25));
+	// neither sleeping task nor the waiting caller spins
+	CHECK(busy < waiting);
+}
+
+TEST_CASE("a waiting worker runs only its own group's tasks") {
+	auto executor = ::word_ladder::work_stealing_executor(2);
+	auto unrelated_ran_while_waiting = std::atomic<bool>{false};
+	auto unrelated_ran = std::latch(1);
+	executor.for_each(1, [&](std::size_t) {
+		auto const waiting_thread = std::this_thread::get_id();
+		auto waiting = std::atomic<bool>{true};
+		// the caller keeps subtask 1, which queues an unrelated task on the caller's deque; subtask 0
+		// is stolen and keeps the other worker busy, so the caller is left waiting with the unrelated
+		// task at hand
+		executor.for_each(2, [&](std::size_t i) {
+			if (i == 1) {
+				executor.submit([&] {
+					if (std::this_thread::get_id() == waiting_thread and waiting) {
+						unrelated_ran_while_waiting = true;
+					}
+					unrelated_ran.count_down();
+				});
+			}
+			else {
+				std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			}
+		});
+		waiting = false;
+	});
+	unrelated_ran.wait();
+	CHECK_FALSE(unrelated_ran_while_waiting);
+}
+
+TEST_CASE("for_each finishes the other tasks and rethrows a task's exception") {
+	auto executor = ::word_ladder::work_stealing_executor(4);
+	auto done = std::atomic<int>{0};
+	CHECK_THROWS_AS(executor.for_each(20,
+	                                  [&](std::size_t i) {
+		                                  if (i == 7) {
+			                                  throw std::runtime_error("task failed");
+		                                  }
+		                                  ++done;
+	                                  }),
+	                std::runtime_error);
+	CHECK(done == 19);
+	// the executor still works afterwards
+	executor.for_each(5, [&](std::size_t) { ++done; });
+	CHECK(done == 24);
+}
+
+TEST_CASE("submitted tasks all run before the executor is destroyed") {
+	auto done = std::atomic<int>{0};
+	{
+		auto executor = ::word_ladder::work_stealing_executor(3);
+		for (auto i = 0; i < 100; ++i) {
+			executor.submit([&] { ++done; });
+		}
+		executor.submit([] { throw std::runtime_error("swallowed"); });
+	}
+	CHECK(done == 100);
+}